@@ -0,0 +1,88 @@
+#ifndef BENCH_BENCH_HPP
+#define BENCH_BENCH_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench {
+
+using clock = std::chrono::steady_clock;
+
+class Stopwatch final {
+  private:
+    clock::time_point start_{clock::now()};
+
+  public:
+    void restart() noexcept { start_ = clock::now(); }
+
+    [[nodiscard]] double elapsed_ms() const noexcept {
+        return std::chrono::duration<double, std::milli>(clock::now() - start_).count();
+    }
+};
+
+/// keeps the optimizer from dropping a computed value
+template <typename T> inline void do_not_optimize(const T &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/// resident set size of the calling process in KiB, 0 when /proc is unavailable
+inline std::size_t current_rss_kib() {
+    std::ifstream status("/proc/self/status");
+    std::string field;
+    while (status >> field) {
+        if (field == "VmRSS:") {
+            std::size_t kib = 0;
+            status >> kib;
+            return kib;
+        }
+    }
+    return 0;
+}
+
+/// n distinct keys in random order, drawn from [1, max_key]
+inline std::vector<int> random_keys(std::size_t n, int max_key, unsigned seed = 42) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(1, max_key);
+
+    std::vector<int> keys;
+    keys.reserve(n + n / 4);
+    while (keys.size() < n) {
+        while (keys.size() < n)
+            keys.push_back(dist(gen));
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    }
+    std::shuffle(keys.begin(), keys.end(), gen);
+    return keys;
+}
+
+/// q query bounds with fst < snd, drawn from [1, max_key]
+inline std::vector<std::pair<int, int>> random_queries(std::size_t q, int max_key,
+                                                       unsigned seed = 7) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(1, max_key);
+
+    std::vector<std::pair<int, int>> queries;
+    queries.reserve(q);
+    while (queries.size() < q) {
+        int fst = dist(gen);
+        int snd = dist(gen);
+        if (fst == snd)
+            continue;
+        if (fst > snd)
+            std::swap(fst, snd);
+        queries.emplace_back(fst, snd);
+    }
+    return queries;
+}
+
+} // namespace bench
+
+#endif // BENCH_BENCH_HPP
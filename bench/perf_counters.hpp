@@ -0,0 +1,63 @@
+#ifndef BENCH_PERF_COUNTERS_HPP
+#define BENCH_PERF_COUNTERS_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace bench {
+
+/// one hardware counter of the calling thread; invalid when perf_event_open is not permitted
+class Perf_counter final {
+  private:
+    int fd_{-1};
+
+  public:
+    explicit Perf_counter(std::uint64_t config, std::uint32_t type = PERF_TYPE_HARDWARE) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = type;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    Perf_counter(const Perf_counter &) = delete;
+    Perf_counter &operator=(const Perf_counter &) = delete;
+
+    ~Perf_counter() {
+        if (fd_ != -1)
+            close(fd_);
+    }
+
+    [[nodiscard]] bool valid() const noexcept { return fd_ != -1; }
+
+    void start() noexcept {
+        if (!valid())
+            return;
+        ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+    }
+
+    std::uint64_t stop() noexcept {
+        if (!valid())
+            return 0;
+        ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+
+        std::uint64_t value = 0;
+        if (read(fd_, &value, sizeof(value)) != sizeof(value))
+            return 0;
+        return value;
+    }
+};
+
+} // namespace bench
+
+#endif // BENCH_PERF_COUNTERS_HPP
@@ -0,0 +1,72 @@
+#include "bench.hpp"
+#include "compact_tree.hpp"
+#include "tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Insert throughput, destruction time and RSS of Tree<int> with the default arena allocator
+// against per-node operator new (std::allocator) and the index-based Compact_tree. Every run
+// happens in a forked child so that RSS is not polluted by the previous run.
+//
+// usage: bench_arena_insert [tree sizes...]
+
+namespace {
+
+template <typename TreeT> void run(const char *name, const std::vector<int> &keys) {
+    const auto rss_before = bench::current_rss_kib();
+    bench::Stopwatch sw;
+
+    auto *tree = new TreeT;
+    for (int key : keys)
+        tree->insert(key);
+
+    const double insert_ms = sw.elapsed_ms();
+    const auto rss_after = bench::current_rss_kib();
+
+    sw.restart();
+    delete tree;
+    const double destroy_ms = sw.elapsed_ms();
+
+    std::printf("%10zu  %-16s insert %9.2f ms (%6.1f Mkeys/s)  destroy %8.2f ms  rss +%8zu KiB "
+                "(%5.1f B/key)\n",
+                keys.size(), name, insert_ms,
+                static_cast<double>(keys.size()) / insert_ms / 1e3, destroy_ms,
+                rss_after - rss_before,
+                static_cast<double>(rss_after - rss_before) * 1024.0 /
+                    static_cast<double>(keys.size()));
+    std::fflush(stdout);
+}
+
+template <typename TreeT> void run_isolated(const char *name, const std::vector<int> &keys) {
+    const pid_t pid = fork();
+    if (pid == 0) {
+        run<TreeT>(name, keys);
+        std::_Exit(EXIT_SUCCESS);
+    }
+    if (pid > 0)
+        waitpid(pid, nullptr, 0);
+    else
+        run<TreeT>(name, keys);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i)
+        sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty())
+        sizes = {100'000, 1'000'000, 10'000'000};
+
+    for (auto n : sizes) {
+        auto keys = bench::random_keys(n, static_cast<int>(std::min<std::size_t>(n * 10, 2e9)));
+
+        run_isolated<RB_tree::Tree<int, std::less<int>, std::allocator<int>>>("operator new", keys);
+        run_isolated<RB_tree::Tree<int>>("arena", keys);
+        run_isolated<RB_tree::Compact_tree<int>>("compact", keys);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,47 @@
+#include "bench.hpp"
+#include "tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// Ingest into a Tree<int> that already holds keys: one insert per key against insert_batch for
+// runs of r consecutive keys, the shape driver() sees between two queries.
+//
+// usage: bench_batch_insert [initial size] [inserted keys]
+
+int main(int argc, char *argv[]) {
+    const std::size_t initial = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+    const std::size_t inserted = argc > 2 ? std::stoul(argv[2]) : 1'000'000;
+
+    auto keys = bench::random_keys(initial + inserted, static_cast<int>(2e9));
+    const std::vector<int> base(keys.begin(), keys.begin() + static_cast<long>(initial));
+    const std::vector<int> fresh(keys.begin() + static_cast<long>(initial), keys.end());
+
+    for (std::size_t run : {1u, 8u, 64u, 1024u, 65536u}) {
+        RB_tree::Tree<int> one_by_one;
+        one_by_one.assign(base);
+        RB_tree::Tree<int> batched;
+        batched.assign(base);
+
+        bench::Stopwatch sw;
+        for (int key : fresh)
+            one_by_one.insert(key);
+        const double insert_ms = sw.elapsed_ms();
+
+        sw.restart();
+        for (std::size_t i = 0; i < fresh.size(); i += run) {
+            const auto len = std::min(run, fresh.size() - i);
+            batched.insert_batch(std::span<const int>(fresh.data() + i, len));
+        }
+        const double batch_ms = sw.elapsed_ms();
+
+        if (!std::equal(one_by_one.begin(), one_by_one.end(), batched.begin(), batched.end())) {
+            std::cerr << "batch insert mismatch for run = " << run << '\n';
+            return EXIT_FAILURE;
+        }
+
+        std::printf("run %6zu  insert %9.2f ms  insert_batch %9.2f ms  speedup %5.2fx\n", run,
+                    insert_ms, batch_ms, insert_ms / batch_ms);
+    }
+    return EXIT_SUCCESS;
+}
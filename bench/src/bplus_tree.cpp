@@ -0,0 +1,85 @@
+#include "bench.hpp"
+#include "bplus_tree.hpp"
+#include "tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <string>
+
+// Inserts random keys into Tree, BPlus_tree and std::set, then counts random ranges; std::set
+// answers by lower_bound/upper_bound + std::distance, so its query time is only shown for small
+// sizes.
+//
+// usage: bench_bplus_tree [queries] [keys...]
+
+namespace {
+
+template <typename C> double insert_all(C &set, const std::vector<int> &keys) {
+    bench::Stopwatch sw;
+    for (int key : keys)
+        set.insert(key);
+    return sw.elapsed_ms();
+}
+
+template <typename C>
+double count_all(const C &set, const std::vector<std::pair<int, int>> &queries, long &checksum) {
+    checksum = 0;
+    bench::Stopwatch sw;
+    for (const auto &[lo, hi] : queries) {
+        if constexpr (requires { set.count_in_range(lo, hi); })
+            checksum += static_cast<long>(set.count_in_range(lo, hi));
+        else
+            checksum += std::distance(set.lower_bound(lo), set.upper_bound(hi));
+    }
+    return sw.elapsed_ms();
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::size_t q = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+    std::vector<std::size_t> sizes;
+    for (int i = 2; i < argc; ++i)
+        sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty())
+        sizes = {10'000, 100'000, 1'000'000, 10'000'000};
+
+    const auto queries = bench::random_queries(q, 1'000'000'000);
+    for (auto n : sizes) {
+        const auto keys = bench::random_keys(n, 1'000'000'000);
+        const auto per_key = [&](double ms) { return ms * 1e6 / static_cast<double>(n); };
+        const auto per_query = [&](double ms) { return ms * 1e6 / static_cast<double>(q); };
+
+        RB_tree::Tree<int> tree;
+        RB_tree::BPlus_tree<int> bplus;
+        const double tree_insert = insert_all(tree, keys);
+        const double bplus_insert = insert_all(bplus, keys);
+
+        long tree_sum, bplus_sum;
+        const double tree_query = count_all(tree, queries, tree_sum);
+        const double bplus_query = count_all(bplus, queries, bplus_sum);
+        if (tree_sum != bplus_sum) {
+            std::cerr << "containers disagree\n";
+            return EXIT_FAILURE;
+        }
+
+        std::set<int> set;
+        const double set_insert = insert_all(set, keys);
+        std::string set_query = "skipped";
+        if (n <= 10'000) { // std::distance is linear in the range
+            long set_sum;
+            const double set_ms = count_all(set, queries, set_sum);
+            set_query = std::to_string(static_cast<long>(per_query(set_ms)));
+            if (set_sum != tree_sum) {
+                std::cerr << "containers disagree\n";
+                return EXIT_FAILURE;
+            }
+        }
+
+        std::printf("%9zu keys  insert ns/key: Tree %6.1f  BPlus %6.1f  std::set %6.1f   "
+                    "query ns/q: Tree %7.1f  BPlus %7.1f  std::set %8s\n",
+                    n, per_key(tree_insert), per_key(bplus_insert), per_key(set_insert),
+                    per_query(tree_query), per_query(bplus_query), set_query.c_str());
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,49 @@
+#include "bench.hpp"
+#include "tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// Cold start of a Tree<int>: one insert per key against assign (sort + linear build) and
+// from_sorted on keys that are already sorted.
+//
+// usage: bench_bulk_load [tree sizes...]
+
+int main(int argc, char *argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i)
+        sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty())
+        sizes = {100'000, 1'000'000, 5'000'000};
+
+    for (auto n : sizes) {
+        auto keys = bench::random_keys(n, static_cast<int>(std::min<std::size_t>(n * 10, 2e9)));
+        auto sorted = keys;
+        std::sort(sorted.begin(), sorted.end());
+
+        bench::Stopwatch sw;
+        RB_tree::Tree<int> inserted;
+        for (int key : keys)
+            inserted.insert(key);
+        const double insert_ms = sw.elapsed_ms();
+
+        sw.restart();
+        RB_tree::Tree<int> assigned;
+        assigned.assign(keys);
+        const double assign_ms = sw.elapsed_ms();
+
+        sw.restart();
+        auto built = RB_tree::Tree<int>::from_sorted(sorted.begin(), sorted.end());
+        const double from_sorted_ms = sw.elapsed_ms();
+
+        if (!assigned.check_invariants() || !built.check_invariants() ||
+            !std::equal(inserted.begin(), inserted.end(), built.begin(), built.end())) {
+            std::cerr << "bulk load mismatch for n = " << n << '\n';
+            return EXIT_FAILURE;
+        }
+
+        std::printf("%10zu  insert %9.2f ms  assign %9.2f ms  from_sorted %9.2f ms\n", n,
+                    insert_ms, assign_ms, from_sorted_ms);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,97 @@
+#include "bench.hpp"
+#include "concurrent_tree.hpp"
+#include "tree.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// One writer inserts keys while R readers answer range counts as fast as they can: Tree behind a
+// global mutex against Concurrent_tree, whose readers never take a lock.
+//
+// usage: bench_concurrent_reads [initial keys] [inserted keys] [readers]
+
+namespace {
+
+struct Result {
+    double write_ms;
+    std::size_t reads;
+};
+
+class Locked_tree final {
+  private:
+    RB_tree::Tree<int> tree_;
+    mutable std::mutex mutex_;
+
+  public:
+    void insert(int key) {
+        std::lock_guard lock(mutex_);
+        tree_.insert(key);
+    }
+
+    std::size_t count_in_range(int lo, int hi) const {
+        std::lock_guard lock(mutex_);
+        return tree_.count_in_range(lo, hi);
+    }
+};
+
+template <typename C>
+Result run(const std::vector<int> &initial, const std::vector<int> &inserted,
+           const std::vector<std::pair<int, int>> &queries, std::size_t readers) {
+    C tree;
+    for (int key : initial)
+        tree.insert(key);
+
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> reads{0};
+    std::vector<std::thread> threads;
+    for (std::size_t r = 0; r < readers; ++r)
+        threads.emplace_back([&, r] {
+            std::size_t count = 0;
+            std::size_t sum = 0;
+            for (std::size_t i = r; !done.load(std::memory_order_relaxed); ++i, ++count) {
+                const auto &[lo, hi] = queries[i % queries.size()];
+                sum += tree.count_in_range(lo, hi);
+            }
+            bench::do_not_optimize(sum);
+            reads.fetch_add(count);
+        });
+
+    bench::Stopwatch sw;
+    for (int key : inserted)
+        tree.insert(key);
+    const double write_ms = sw.elapsed_ms();
+
+    done.store(true);
+    for (auto &t : threads)
+        t.join();
+    return {write_ms, reads.load()};
+}
+
+void report(const char *name, const Result &r) {
+    std::printf("%-28s writer %9.2f ms  reads %10zu  (%7.2f Mreads/s)\n", name, r.write_ms,
+                r.reads, static_cast<double>(r.reads) / r.write_ms / 1e3);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+    const std::size_t m = argc > 2 ? std::stoul(argv[2]) : 200'000;
+    const std::size_t readers =
+        argc > 3 ? std::stoul(argv[3]) : std::max(1u, std::thread::hardware_concurrency() - 1);
+
+    const int max_key = static_cast<int>(std::min<std::size_t>((n + m) * 10, 2e9));
+    auto keys = bench::random_keys(n + m, max_key);
+    const std::vector<int> initial(keys.begin(), keys.begin() + static_cast<std::ptrdiff_t>(n));
+    const std::vector<int> inserted(keys.begin() + static_cast<std::ptrdiff_t>(n), keys.end());
+    const auto queries = bench::random_queries(1 << 16, max_key);
+
+    std::printf("%zu initial keys, %zu inserts, %zu readers\n", n, m, readers);
+    report("Tree + std::mutex", run<Locked_tree>(initial, inserted, queries, readers));
+    report("Concurrent_tree", run<RB_tree::Concurrent_tree<int>>(initial, inserted, queries,
+                                                                  readers));
+    return EXIT_SUCCESS;
+}
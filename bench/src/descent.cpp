@@ -0,0 +1,159 @@
+#include "bench.hpp"
+#include "perf_counters.hpp"
+#include "tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <x86intrin.h>
+
+// Compares the branchy lower_bound/upper_bound descent Tree used to have (rebuilt here on the
+// public Node interface) with the branchless, prefetching descent, both as two separate searches
+// and as one interleaved bounds() pass, plus count_in_range. Reports time and TSC cycles per
+// query, and branch misses and core cycles when perf_event_open is permitted.
+//
+// usage: bench_descent [queries] [tree sizes...]
+
+namespace {
+
+using Node = RB_tree::Node<int>;
+
+const Node *root_of(const RB_tree::Tree<int> &tree) {
+    const Node *node = tree.begin().get();
+    while (!node->get_parent()->is_nil())
+        node = node->get_parent();
+    return node;
+}
+
+/// the descent as it was: data-dependent branches on every level
+const Node *branchy_lower_bound(const Node *current, int key) {
+    const Node *candidate = current->get_parent();
+    while (!current->is_nil()) {
+        if (current->get_key() < key)
+            current = current->get_right();
+        else
+            candidate = std::exchange(current, current->get_left());
+    }
+    return candidate;
+}
+
+const Node *branchy_upper_bound(const Node *current, int key) {
+    const Node *candidate = current->get_parent();
+    while (!current->is_nil()) {
+        if (key < current->get_key())
+            candidate = std::exchange(current, current->get_left());
+        else
+            current = current->get_right();
+    }
+    return candidate;
+}
+
+std::size_t branchy_rank(const Node *current, int key, bool inclusive) {
+    std::size_t rank = 0;
+    while (!current->is_nil()) {
+        if (current->get_key() < key || (inclusive && current->get_key() == key)) {
+            rank += current->get_left()->size_ + 1;
+            current = current->get_right();
+        } else
+            current = current->get_left();
+    }
+    return rank;
+}
+
+struct Measurement {
+    double ns;
+    double tsc;
+    double branch_misses;
+    double cycles;
+    std::size_t checksum;
+};
+
+template <typename F>
+Measurement measure(const std::vector<std::pair<int, int>> &queries, F &&query) {
+    bench::Perf_counter misses(PERF_COUNT_HW_BRANCH_MISSES);
+    bench::Perf_counter cycles(PERF_COUNT_HW_CPU_CYCLES);
+    std::size_t checksum = 0;
+
+    bench::Stopwatch sw;
+    misses.start();
+    cycles.start();
+    const auto tsc_start = __rdtsc();
+    for (auto [lo, hi] : queries)
+        checksum += query(lo, hi);
+    const auto tsc = __rdtsc() - tsc_start;
+    const auto cycle_count = cycles.stop();
+    const auto miss_count = misses.stop();
+    const double ms = sw.elapsed_ms();
+
+    bench::do_not_optimize(checksum);
+    const auto q = static_cast<double>(queries.size());
+    return {ms * 1e6 / q, static_cast<double>(tsc) / q, static_cast<double>(miss_count) / q,
+            static_cast<double>(cycle_count) / q, checksum};
+}
+
+void report(std::size_t n, const char *method, const Measurement &m, bool have_counters) {
+    std::printf("%10zu  %-34s %8.1f ns/query %8.0f tsc/query", n, method, m.ns, m.tsc);
+    if (have_counters)
+        std::printf(" %8.0f cycles/query %6.2f branch misses/query", m.cycles, m.branch_misses);
+    std::printf("\n");
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::size_t n_queries = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+    std::vector<std::size_t> sizes;
+    for (int i = 2; i < argc; ++i)
+        sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty())
+        sizes = {10'000, 100'000, 1'000'000, 10'000'000};
+
+    const bool have_counters = bench::Perf_counter(PERF_COUNT_HW_BRANCH_MISSES).valid();
+    if (!have_counters)
+        std::cerr << "perf_event_open is not permitted, reporting time and TSC cycles only\n";
+
+    for (auto n : sizes) {
+        const int max_key = static_cast<int>(std::min<std::size_t>(n * 10, 1'000'000'000));
+        RB_tree::Tree<int> tree;
+        for (int key : bench::random_keys(n, max_key))
+            tree.insert(key);
+        const auto queries = bench::random_queries(n_queries, max_key);
+        const Node *root = root_of(tree);
+        const auto *nil = root->get_parent();
+
+        // the bound pairs are checked through the key after the upper bound
+        const auto mix = [nil](const Node *lower, const Node *upper) {
+            return static_cast<std::size_t>(lower == nil ? 0 : lower->get_key()) ^
+                   static_cast<std::size_t>(upper == nil ? 0 : upper->get_key());
+        };
+
+        const auto branchy = measure(queries, [&](int lo, int hi) {
+            return mix(branchy_lower_bound(root, lo), branchy_upper_bound(root, hi));
+        });
+        const auto branchless = measure(queries, [&](int lo, int hi) {
+            return mix(tree.lower_bound(lo).get(), tree.upper_bound(hi).get());
+        });
+        const auto interleaved = measure(queries, [&](int lo, int hi) {
+            const auto [lower, upper] = tree.bounds(lo, hi);
+            return mix(lower.get(), upper.get());
+        });
+        const auto branchy_count = measure(queries, [&](int lo, int hi) {
+            return branchy_rank(root, hi, true) - branchy_rank(root, lo, false);
+        });
+        const auto count = measure(queries, [&](int lo, int hi) {
+            return tree.count_in_range(lo, hi);
+        });
+
+        if (branchy.checksum != branchless.checksum || branchy.checksum != interleaved.checksum ||
+            branchy_count.checksum != count.checksum) {
+            std::cerr << "checksum mismatch for n = " << n << '\n';
+            return EXIT_FAILURE;
+        }
+
+        report(n, "branchy lower_bound + upper_bound", branchy, have_counters);
+        report(n, "branchless lower_bound + upper_bound", branchless, have_counters);
+        report(n, "interleaved bounds()", interleaved, have_counters);
+        report(n, "branchy rank + upper_rank", branchy_count, have_counters);
+        report(n, "interleaved count_in_range", count, have_counters);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,56 @@
+#include "bench.hpp"
+#include "compact_tree.hpp"
+#include "tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <string>
+
+// Erases every key of a tree in random order: Tree and Compact_tree against std::set::erase.
+//
+// usage: bench_erase [tree sizes...]
+
+namespace {
+
+template <typename C>
+double erase_all(const std::vector<int> &keys, const std::vector<int> &order) {
+    C tree;
+    for (int key : keys)
+        tree.insert(key);
+
+    bench::Stopwatch sw;
+    std::size_t erased = 0;
+    for (int key : order)
+        erased += tree.erase(key);
+    const double ms = sw.elapsed_ms();
+
+    if (erased != keys.size() || tree.begin() != tree.end()) {
+        std::cerr << "erase left keys behind\n";
+        std::exit(EXIT_FAILURE);
+    }
+    return ms;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i)
+        sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty())
+        sizes = {100'000, 1'000'000};
+
+    for (auto n : sizes) {
+        auto keys = bench::random_keys(n, static_cast<int>(std::min<std::size_t>(n * 10, 2e9)));
+        auto order = keys;
+        std::shuffle(order.begin(), order.end(), std::mt19937(11));
+
+        const double tree_ms = erase_all<RB_tree::Tree<int>>(keys, order);
+        const double compact_ms = erase_all<RB_tree::Compact_tree<int>>(keys, order);
+        const double set_ms = erase_all<std::set<int>>(keys, order);
+
+        std::printf("%10zu  Tree %9.2f ms  Compact_tree %9.2f ms  std::set %9.2f ms\n", n, tree_ms,
+                    compact_ms, set_ms);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,65 @@
+#include "bench.hpp"
+#include "compact_tree.hpp"
+#include "eytzinger_index.hpp"
+#include "tree.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// Counts random ranges on Tree, Compact_tree and a frozen Eytzinger_index at sizes from L1 to well
+// past the last-level cache, and reports the index build time next to the query time it saves.
+//
+// usage: bench_eytzinger [queries] [keys...]
+
+namespace {
+
+template <typename C>
+double count_all(const C &set, const std::vector<std::pair<int, int>> &queries, long &checksum) {
+    checksum = 0;
+    bench::Stopwatch sw;
+    for (const auto &[lo, hi] : queries)
+        checksum += static_cast<long>(set.count_in_range(lo, hi));
+    return sw.elapsed_ms();
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::size_t q = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+    std::vector<std::size_t> sizes;
+    for (int i = 2; i < argc; ++i)
+        sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty())
+        sizes = {1'000, 10'000, 100'000, 1'000'000, 10'000'000};
+
+    const auto queries = bench::random_queries(q, 1'000'000'000);
+    for (auto n : sizes) {
+        auto keys = bench::random_keys(n, 1'000'000'000);
+        std::sort(keys.begin(), keys.end());
+        const auto tree = RB_tree::Tree<int>::from_sorted(keys.begin(), keys.end());
+        RB_tree::Compact_tree<int> compact;
+        for (int key : keys)
+            compact.insert(key);
+
+        bench::Stopwatch sw;
+        const RB_tree::Eytzinger_index<int> index(tree);
+        const double build_ms = sw.elapsed_ms();
+
+        long tree_sum, compact_sum, index_sum;
+        const double tree_ms = count_all(tree, queries, tree_sum);
+        const double compact_ms = count_all(compact, queries, compact_sum);
+        const double index_ms = count_all(index, queries, index_sum);
+        if (tree_sum != index_sum || compact_sum != index_sum) {
+            std::cerr << "containers disagree\n";
+            return EXIT_FAILURE;
+        }
+
+        const auto per_query = [&](double ms) { return ms * 1e6 / static_cast<double>(q); };
+        std::printf("%9zu keys  Tree %7.1f ns/q  Compact_tree %7.1f ns/q  Eytzinger %7.1f ns/q "
+                    "(build %8.2f ms)  speedup vs Tree %5.2fx\n",
+                    n, per_query(tree_ms), per_query(compact_ms), per_query(index_ms), build_ms,
+                    tree_ms / index_ms);
+    }
+    return EXIT_SUCCESS;
+}
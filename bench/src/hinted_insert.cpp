@@ -0,0 +1,73 @@
+#include "bench.hpp"
+#include "tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <string>
+
+// Inserts monotonic, near-sorted and random key streams into Tree<int> with and without a hint
+// (the position of the previous insert) and into std::set with and without a hint.
+//
+// usage: bench_hinted_insert [keys]
+
+namespace {
+
+template <typename Insert> double time_inserts(const std::vector<int> &keys, Insert &&insert) {
+    bench::Stopwatch sw;
+    for (int key : keys)
+        insert(key);
+    return sw.elapsed_ms();
+}
+
+void run(const char *stream, const std::vector<int> &keys) {
+    RB_tree::Tree<int> plain;
+    const double plain_ms = time_inserts(keys, [&](int key) { plain.insert(key); });
+
+    RB_tree::Tree<int> hinted;
+    auto hint = hinted.end();
+    const double hinted_ms = time_inserts(keys, [&](int key) { hint = hinted.insert(hint, key); });
+
+    std::set<int> set_plain;
+    const double set_ms = time_inserts(keys, [&](int key) { set_plain.insert(key); });
+
+    std::set<int> set_hinted;
+    auto set_hint = set_hinted.end();
+    const double set_hinted_ms = time_inserts(keys, [&](int key) {
+        set_hint = std::next(set_hinted.insert(set_hint, key));
+    });
+
+    if (!std::equal(plain.begin(), plain.end(), hinted.begin(), hinted.end()) ||
+        !std::equal(hinted.begin(), hinted.end(), set_hinted.begin(), set_hinted.end())) {
+        std::cerr << "hinted insert mismatch for " << stream << '\n';
+        std::exit(EXIT_FAILURE);
+    }
+
+    std::printf("%-12s Tree %8.2f ms  Tree+hint %8.2f ms  std::set %8.2f ms  "
+                "std::set+hint %8.2f ms\n",
+                stream, plain_ms, hinted_ms, set_ms, set_hinted_ms);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+
+    std::vector<int> monotonic(n);
+    for (std::size_t i = 0; i < n; ++i)
+        monotonic[i] = static_cast<int>(i * 3);
+
+    // timestamps that arrive slightly out of order: shuffled inside windows of 16
+    auto near_sorted = monotonic;
+    std::mt19937 gen(3);
+    for (std::size_t i = 0; i < n; i += 16)
+        std::shuffle(near_sorted.begin() + static_cast<long>(i),
+                     near_sorted.begin() + static_cast<long>(std::min(n, i + 16)), gen);
+
+    auto random = monotonic;
+    std::shuffle(random.begin(), random.end(), gen);
+
+    run("monotonic", monotonic);
+    run("near-sorted", near_sorted);
+    run("random", random);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+#include "bench.hpp"
+#include "node_search.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+
+// Times one in-node search (number of keys less than a bound) per kernel level the CPU supports
+// against std::lower_bound, for node sizes around the B+-tree's inner (14) and leaf (58) nodes.
+//
+// usage: bench_node_search [searches] [node sizes...]
+
+namespace {
+
+constexpr std::size_t node_count = 1024; // 58 KiB of leaves: the nodes stay in L2
+
+template <typename Search>
+double time_searches(std::size_t searches, std::size_t n, const std::vector<int> &keys,
+                     const std::vector<int> &bounds, Search search, std::size_t &checksum) {
+    checksum = 0;
+    bench::Stopwatch sw;
+    for (std::size_t i = 0; i < searches; ++i) {
+        const int *node = keys.data() + (i % node_count) * n;
+        checksum += search(node, n, bounds[i % bounds.size()]);
+    }
+    return sw.elapsed_ms() * 1e6 / static_cast<double>(searches);
+}
+
+const char *isa_name(RB_tree::Isa isa) {
+    switch (isa) {
+    case RB_tree::Isa::avx2:
+        return "avx2";
+    case RB_tree::Isa::sse42:
+        return "sse4.2";
+    default:
+        return "scalar";
+    }
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::size_t searches = argc > 1 ? std::stoul(argv[1]) : 20'000'000;
+    std::vector<std::size_t> sizes;
+    for (int i = 2; i < argc; ++i)
+        sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty())
+        sizes = {8, 14, 16, 32, 58, 64};
+
+    std::mt19937 gen(17);
+    std::vector<int> bounds(1 << 16);
+    for (auto &bound : bounds)
+        bound = static_cast<int>(gen() % 1'000'000);
+
+    std::cout << "detected: " << isa_name(RB_tree::detect_isa()) << "\n";
+    for (auto n : sizes) {
+        std::vector<int> keys(node_count * n);
+        for (auto &key : keys)
+            key = static_cast<int>(gen() % 1'000'000);
+        for (std::size_t i = 0; i < node_count; ++i)
+            std::sort(keys.begin() + static_cast<std::ptrdiff_t>(i * n),
+                      keys.begin() + static_cast<std::ptrdiff_t>((i + 1) * n));
+
+        std::size_t expected;
+        const double binary_ns = time_searches(
+            searches, n, keys, bounds,
+            [](const int *node, std::size_t size, int bound) {
+                return static_cast<std::size_t>(std::lower_bound(node, node + size, bound) - node);
+            },
+            expected);
+        std::printf("%3zu keys  std::lower_bound %6.2f ns", n, binary_ns);
+
+        for (auto isa : {RB_tree::Isa::scalar, RB_tree::Isa::sse42, RB_tree::Isa::avx2}) {
+            if (isa > RB_tree::detect_isa())
+                continue;
+            std::size_t checksum;
+            const double ns = time_searches(
+                searches, n, keys, bounds,
+                [isa](const int *node, std::size_t size, int bound) {
+                    return RB_tree::node_search::count<true>(isa, node, size, bound);
+                },
+                checksum);
+            if (checksum != expected) {
+                std::cerr << isa_name(isa) << " kernel disagrees\n";
+                return EXIT_FAILURE;
+            }
+            std::printf("  %s %6.2f ns", isa_name(isa), ns);
+        }
+        std::printf("\n");
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,111 @@
+#include "bench.hpp"
+#include "command_reader.hpp"
+#include "fenwick_set.hpp"
+#include "tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <set>
+#include <string>
+
+// Replays generated k/q/d workloads end to end: online Tree and std::set against the offline
+// Fenwick_set, whose time includes collecting and compressing the key universe.
+//
+// usage: bench_offline_engine [commands...]
+
+namespace {
+
+/// roughly the generator's mix: two inserts per query, erase_percent of the updates erase
+std::vector<RB_tree::Command> make_workload(std::size_t n, int erase_percent, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(1, 1'000'000'000);
+    std::vector<RB_tree::Command> commands;
+    std::vector<int> live;
+    commands.reserve(n);
+    while (commands.size() < n) {
+        if (gen() % 3 == 0) {
+            int lo = dist(gen);
+            int hi = dist(gen);
+            if (lo > hi)
+                std::swap(lo, hi);
+            commands.push_back({'q', {lo, hi}});
+        } else if (!live.empty() && static_cast<int>(gen() % 100) < erase_percent) {
+            const auto pos = gen() % live.size();
+            commands.push_back({'d', {live[pos], 0}});
+            live[pos] = live.back();
+            live.pop_back();
+        } else {
+            live.push_back(dist(gen));
+            commands.push_back({'k', {live.back(), 0}});
+        }
+    }
+    return commands;
+}
+
+template <typename C> std::size_t apply(C &set, const std::vector<RB_tree::Command> &commands) {
+    std::size_t sum = 0;
+    for (const auto &cmd : commands) {
+        if (cmd.op == 'k')
+            set.insert(cmd.args[0]);
+        else if (cmd.op == 'd')
+            set.erase(cmd.args[0]);
+        else if constexpr (requires { set.count_in_range(0, 0); })
+            sum += set.count_in_range(cmd.args[0], cmd.args[1]);
+        else
+            sum += static_cast<std::size_t>(std::distance(set.lower_bound(cmd.args[0]),
+                                                          set.upper_bound(cmd.args[1])));
+    }
+    return sum;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i)
+        sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty())
+        sizes = {100'000, 1'000'000, 3'000'000};
+
+    for (auto n : sizes) {
+        for (int erase_percent : {0, 20}) {
+            const auto commands = make_workload(n, erase_percent, 3);
+
+            bench::Stopwatch sw;
+            RB_tree::Tree<int> tree;
+            const auto tree_sum = apply(tree, commands);
+            const double tree_ms = sw.elapsed_ms();
+
+            double set_ms = 0;
+            std::size_t set_sum = tree_sum;
+            if (n <= 100'000) { // std::distance makes std::set quadratic
+                sw.restart();
+                std::set<int> set;
+                set_sum = apply(set, commands);
+                set_ms = sw.elapsed_ms();
+            }
+
+            sw.restart();
+            std::vector<int> universe;
+            for (const auto &cmd : commands)
+                if (cmd.op == 'k')
+                    universe.push_back(cmd.args[0]);
+            RB_tree::Fenwick_set<int> fenwick(std::move(universe));
+            const double build_ms = sw.elapsed_ms();
+            const auto fenwick_sum = apply(fenwick, commands);
+            const double fenwick_ms = sw.elapsed_ms();
+
+            if (tree_sum != fenwick_sum || tree_sum != set_sum) {
+                std::cerr << "engines disagree\n";
+                return EXIT_FAILURE;
+            }
+            const auto set_text = set_ms > 0 ? std::to_string(static_cast<long>(set_ms)) + " ms"
+                                             : std::string("skipped");
+            std::printf("%9zu cmds, %2d%% erase  Tree %9.2f ms  std::set %10s  "
+                        "Fenwick %9.2f ms (build %7.2f)  speedup vs Tree %5.2fx\n",
+                        n, erase_percent, tree_ms, set_text.c_str(), fenwick_ms, build_ms,
+                        tree_ms / fenwick_ms);
+        }
+    }
+    return EXIT_SUCCESS;
+}
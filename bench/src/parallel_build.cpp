@@ -0,0 +1,91 @@
+#include "bench.hpp"
+#include "parallel_sort.hpp"
+#include "thread_pool.hpp"
+#include "tree.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <span>
+#include <string>
+#include <thread>
+
+// Speedup of the parallel bulk paths over 1 to N threads against one insert per key:
+// parallel_sort of the unsorted keys, Tree::from_sorted across the pool, and insert_batch
+// across the pool of a batch of keys/50 new keys into a tree of keys (split, parallel finger
+// inserts, join) and of a batch as large as the tree (parallel merge and rebuild). On fewer
+// cores than threads the speedup stays at or below 1.
+//
+// usage: bench_parallel_build [keys] [max threads]
+
+namespace {
+
+template <typename F> double time_ms(F &&f) {
+    bench::Stopwatch sw;
+    f();
+    return sw.elapsed_ms();
+}
+
+using Tree = RB_tree::Tree<int>;
+
+bool same(const Tree &a, const Tree &b) {
+    return a.check_invariants() && std::equal(a.begin(), a.end(), b.begin(), b.end());
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 10'000'000;
+    const std::size_t max_threads =
+        argc > 2 ? std::stoul(argv[2]) : std::max(4u, std::thread::hardware_concurrency());
+
+    const int max_key = static_cast<int>(std::min<std::size_t>(n * 10, 2e9));
+    const auto keys = bench::random_keys(n, max_key);
+    const auto batch = bench::random_keys(n / 50, max_key, 7);
+    const auto big_batch = bench::random_keys(n, max_key, 8);
+    std::printf("%zu keys, batches of %zu and %zu, %u cores\n", n, batch.size(), big_batch.size(),
+                std::thread::hardware_concurrency());
+
+    Tree inserted;
+    const double insert_ms = time_ms([&] {
+        for (int key : keys)
+            inserted.insert(key);
+    });
+    auto sorted_keys = keys;
+    std::sort(sorted_keys.begin(), sorted_keys.end());
+    Tree batch_inserted = Tree::from_sorted(sorted_keys.begin(), sorted_keys.end());
+    const double batch_insert_ms = time_ms([&] {
+        for (int key : batch)
+            batch_inserted.insert(key);
+    });
+    std::printf("sequential insert: load %9.1f ms  batch %9.1f ms\n", insert_ms, batch_insert_ms);
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        RB_tree::Thread_pool pool(threads);
+
+        auto sorted = keys;
+        const double sort_ms = time_ms(
+            [&] { RB_tree::parallel_sort(std::span<int>(sorted), std::less<int>(), pool); });
+        Tree built;
+        const double build_ms =
+            time_ms([&] { built = Tree::from_sorted(sorted.begin(), sorted.end(), pool); });
+
+        Tree small = Tree::from_sorted(sorted.begin(), sorted.end(), pool);
+        const double small_ms = time_ms([&] { small.insert_batch(batch, pool); });
+        Tree big = Tree::from_sorted(sorted.begin(), sorted.end(), pool);
+        const double big_ms = time_ms([&] { big.insert_batch(big_batch, pool); });
+
+        if (!same(built, inserted) || !same(small, batch_inserted) ||
+            big.size() < inserted.size() || !big.check_invariants()) {
+            std::cerr << "parallel build differs on " << threads << " threads\n";
+            return EXIT_FAILURE;
+        }
+
+        const double load_ms = sort_ms + build_ms;
+        std::printf("%3zu threads  sort %8.1f ms  build %8.1f ms  load %5.2fx  batch %8.1f ms "
+                    "%5.2fx  big batch %8.1f ms\n",
+                    threads, sort_ms, build_ms, insert_ms / load_ms, small_ms,
+                    batch_insert_ms / small_ms, big_ms);
+    }
+    return EXIT_SUCCESS;
+}
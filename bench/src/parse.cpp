@@ -0,0 +1,141 @@
+#include "bench.hpp"
+#include "command_reader.hpp"
+#include "tree.hpp"
+#include "workload_format.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
+// Parses one generated k/q workload file with std::ifstream extraction, with Command_reader on
+// read() blocks and with Command_reader on a mapping, then the same workload converted to the
+// binary format with Workload_reader, and replays the parsed commands into a Tree, so parse time
+// and tree time are reported separately.
+//
+// usage: bench_parse [keys] [queries]
+
+namespace {
+
+template <typename Reader> double parse(Reader &reader, std::vector<RB_tree::Command> &out) {
+    out.clear();
+    bench::Stopwatch sw;
+    RB_tree::Command cmd;
+    while (reader.next(cmd))
+        out.push_back(cmd);
+    return sw.elapsed_ms();
+}
+
+double parse_file(const std::string &path, bool allow_mmap, std::vector<RB_tree::Command> &out) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::perror(path.c_str());
+        std::exit(EXIT_FAILURE);
+    }
+    bench::Stopwatch sw;
+    {
+        RB_tree::Command_reader reader(fd, allow_mmap);
+        parse(reader, out);
+    }
+    const double ms = sw.elapsed_ms();
+    close(fd);
+    return ms;
+}
+
+double replay(const std::vector<RB_tree::Command> &commands) {
+    bench::Stopwatch sw;
+    RB_tree::Tree<int> tree;
+    std::size_t sum = 0;
+    for (const auto &cmd : commands) {
+        if (cmd.op == 'k')
+            tree.insert(cmd.args[0]);
+        else if (cmd.op == 'q')
+            sum += tree.count_in_range(cmd.args[0], cmd.args[1]);
+    }
+    bench::do_not_optimize(sum);
+    return sw.elapsed_ms();
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+    const std::size_t q = argc > 2 ? std::stoul(argv[2]) : 1'000'000;
+
+    const int max_key = 1'000'000'000;
+    const auto keys = bench::random_keys(n, max_key);
+    const auto queries = bench::random_queries(q, max_key);
+
+    char path[] = "/tmp/bench_parse_XXXXXX";
+    const int fd = mkstemp(path);
+    if (fd < 0) {
+        std::perror("mkstemp");
+        return EXIT_FAILURE;
+    }
+    close(fd);
+    {
+        std::ofstream out(path);
+        std::size_t qi = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            out << "k " << keys[i] << '\n';
+            for (; qi < q && qi * n < (i + 1) * q; ++qi)
+                out << "q " << queries[qi].first << ' ' << queries[qi].second << '\n';
+        }
+    }
+
+    std::ifstream probe(path, std::ios::ate);
+    const double mb = static_cast<double>(probe.tellg()) / (1 << 20);
+
+    std::vector<RB_tree::Command> commands;
+    std::ifstream in(path);
+    RB_tree::Stream_reader stream(in);
+    const double stream_ms = parse(stream, commands);
+    const auto expected = commands.size();
+
+    const double block_ms = parse_file(path, false, commands);
+    const double mmap_ms = parse_file(path, true, commands);
+    if (commands.size() != expected) {
+        std::cerr << "readers disagree on the number of commands\n";
+        return EXIT_FAILURE;
+    }
+
+    const std::string binary_path = std::string(path) + ".rqw";
+    {
+        std::ofstream out(binary_path, std::ios::binary);
+        RB_tree::Workload_writer writer(out);
+        for (const auto &cmd : commands)
+            writer.write(cmd);
+    }
+    std::ifstream binary_probe(binary_path, std::ios::ate | std::ios::binary);
+    const double binary_mb = static_cast<double>(binary_probe.tellg()) / (1 << 20);
+
+    const int binary_fd = open(binary_path.c_str(), O_RDONLY);
+    bench::Stopwatch binary_sw;
+    {
+        RB_tree::Workload_reader reader(binary_fd);
+        parse(reader, commands);
+    }
+    const double binary_ms = binary_sw.elapsed_ms();
+    close(binary_fd);
+    if (commands.size() != expected) {
+        std::cerr << "binary replay lost commands\n";
+        return EXIT_FAILURE;
+    }
+
+    const double tree_ms = replay(commands);
+    std::remove(path);
+    std::remove(binary_path.c_str());
+
+    std::printf("%zu keys, %zu queries, %.1f MiB\n", n, q, mb);
+    std::printf("parse  std::ifstream >>      %9.2f ms  %8.1f MiB/s\n", stream_ms,
+                mb / stream_ms * 1e3);
+    std::printf("parse  Command_reader read() %9.2f ms  %8.1f MiB/s\n", block_ms,
+                mb / block_ms * 1e3);
+    std::printf("parse  Command_reader mmap   %9.2f ms  %8.1f MiB/s\n", mmap_ms,
+                mb / mmap_ms * 1e3);
+    std::printf("parse  Workload_reader (binary, %.1f MiB) %9.2f ms\n", binary_mb, binary_ms);
+    std::printf("tree   insert + count        %9.2f ms\n", tree_ms);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,107 @@
+#include "bench.hpp"
+#include "range_query.hpp"
+#include "tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <span>
+#include <string>
+
+// Compares answering range queries one at a time with range_query against range_query_batch and
+// against count_in_range_batch with several group sizes (queries per group, two descents each),
+// on trees of growing size. Queries are handed over in runs as long as the ones driver()
+// collects.
+//
+// usage: bench_query_batch [queries] [tree sizes...]
+
+namespace {
+
+constexpr std::size_t run_length = 1 << 16;
+
+using Queries = std::vector<std::pair<int, int>>;
+
+struct Measurement {
+    double ns;
+    long checksum;
+};
+
+/// answer(run, out) fills out with the answers of every query of run
+template <typename F> Measurement measure(const Queries &queries, F &&answer) {
+    std::vector<long> out(run_length);
+    long checksum = 0;
+
+    bench::Stopwatch sw;
+    for (std::size_t first = 0; first < queries.size(); first += run_length) {
+        const auto n = std::min(run_length, queries.size() - first);
+        answer(std::span<const std::pair<int, int>>(queries).subspan(first, n),
+               std::span(out).first(n));
+        for (std::size_t i = 0; i < n; ++i)
+            checksum += out[i];
+    }
+    const double ms = sw.elapsed_ms();
+
+    bench::do_not_optimize(checksum);
+    return {ms * 1e6 / static_cast<double>(queries.size()), checksum};
+}
+
+template <std::size_t Group>
+Measurement measure_group(const RB_tree::Tree<int> &tree, const Queries &queries) {
+    return measure(queries, [&](auto run, auto out) {
+        tree.count_in_range_batch<Group>(run, out);
+        // the same answers range_query gives for a one-key interval
+        for (std::size_t i = 0; i < run.size(); ++i)
+            if (run[i].first >= run[i].second)
+                out[i] = 0;
+    });
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::size_t n_queries = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+    std::vector<std::size_t> sizes;
+    for (int i = 2; i < argc; ++i)
+        sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty())
+        sizes = {10'000, 100'000, 1'000'000, 10'000'000};
+
+    for (auto n : sizes) {
+        const int max_key = static_cast<int>(std::min<std::size_t>(n * 10, 1'000'000'000));
+        RB_tree::Tree<int> tree;
+        for (int key : bench::random_keys(n, max_key))
+            tree.insert(key);
+        const auto queries = bench::random_queries(n_queries, max_key);
+
+        const auto single = measure(queries, [&](auto run, auto out) {
+            for (std::size_t i = 0; i < run.size(); ++i)
+                out[i] = RB_tree::range_query(tree, run[i].first, run[i].second);
+        });
+        const auto batch = measure(queries, [&](auto run, auto out) {
+            RB_tree::range_query_batch(tree, run, out);
+        });
+        const std::pair<const char *, Measurement> groups[] = {
+            {"count_in_range_batch<2>", measure_group<2>(tree, queries)},
+            {"count_in_range_batch<4>", measure_group<4>(tree, queries)},
+            {"count_in_range_batch<8>", measure_group<8>(tree, queries)},
+            {"count_in_range_batch<16>", measure_group<16>(tree, queries)},
+            {"count_in_range_batch<32>", measure_group<32>(tree, queries)},
+        };
+
+        for (const auto &[name, m] : groups)
+            if (m.checksum != single.checksum) {
+                std::cerr << name << ": checksum mismatch for n = " << n << '\n';
+                return EXIT_FAILURE;
+            }
+        if (batch.checksum != single.checksum) {
+            std::cerr << "range_query_batch: checksum mismatch for n = " << n << '\n';
+            return EXIT_FAILURE;
+        }
+
+        std::printf("%10zu  %-26s %8.1f ns/query\n", n, "range_query", single.ns);
+        std::printf("%10zu  %-26s %8.1f ns/query  %5.2fx\n", n, "range_query_batch", batch.ns,
+                    single.ns / batch.ns);
+        for (const auto &[name, m] : groups)
+            std::printf("%10zu  %-26s %8.1f ns/query  %5.2fx\n", n, name, m.ns,
+                        single.ns / m.ns);
+    }
+    return EXIT_SUCCESS;
+}
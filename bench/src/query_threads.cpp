@@ -0,0 +1,82 @@
+#include "bench.hpp"
+#include "compact_tree.hpp"
+#include "range_query.hpp"
+#include "thread_pool.hpp"
+#include "tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <span>
+#include <string>
+#include <thread>
+
+// Answers a query-heavy workload with range_query_run on 1..N threads, in runs as long as the
+// ones driver() hands to the pool, and reports throughput and speedup over one thread.
+//
+// usage: bench_query_threads [keys] [queries] [max threads]
+
+namespace {
+
+constexpr std::size_t run_length = 1 << 16;
+
+template <typename C>
+double answer_all(const C &tree, const std::vector<std::pair<int, int>> &queries,
+                  RB_tree::Thread_pool &pool, long &checksum) {
+    std::vector<long> results(run_length);
+    checksum = 0;
+
+    bench::Stopwatch sw;
+    for (std::size_t first = 0; first < queries.size(); first += run_length) {
+        const auto n = std::min(run_length, queries.size() - first);
+        RB_tree::range_query_run(tree, std::span(queries).subspan(first, n),
+                                 std::span(results).first(n), pool);
+        for (std::size_t i = 0; i < n; ++i)
+            checksum += results[i];
+    }
+    return sw.elapsed_ms();
+}
+
+template <typename C>
+void scale(const char *name, const C &tree, const std::vector<std::pair<int, int>> &queries,
+           std::size_t max_threads) {
+    double serial_ms = 0;
+    long serial_sum = 0;
+    for (std::size_t threads = 1; threads <= max_threads; ++threads) {
+        RB_tree::Thread_pool pool(threads);
+        long checksum = 0;
+        const double ms = answer_all(tree, queries, pool, checksum);
+        if (threads == 1) {
+            serial_ms = ms;
+            serial_sum = checksum;
+        } else if (checksum != serial_sum) {
+            std::cerr << name << ": answers differ on " << threads << " threads\n";
+            std::exit(EXIT_FAILURE);
+        }
+        std::printf("%-12s %3zu threads %9.2f ms %8.2f Mq/s  speedup %5.2fx\n", name, threads, ms,
+                    static_cast<double>(queries.size()) / ms / 1e3, serial_ms / ms);
+    }
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+    const std::size_t q = argc > 2 ? std::stoul(argv[2]) : 1'000'000;
+    const std::size_t max_threads =
+        argc > 3 ? std::stoul(argv[3]) : std::max(1u, std::thread::hardware_concurrency());
+
+    const int max_key = static_cast<int>(std::min<std::size_t>(n * 10, 2e9));
+    const auto keys = bench::random_keys(n, max_key);
+    const auto queries = bench::random_queries(q, max_key);
+
+    RB_tree::Tree<int> tree;
+    RB_tree::Compact_tree<int> compact;
+    for (int key : keys) {
+        tree.insert(key);
+        compact.insert(key);
+    }
+
+    std::printf("%zu keys, %zu queries\n", n, q);
+    scale("Tree", tree, queries, max_threads);
+    scale("Compact_tree", compact, queries, max_threads);
+    return EXIT_SUCCESS;
+}
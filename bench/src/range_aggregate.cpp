@@ -0,0 +1,83 @@
+#include "augment.hpp"
+#include "bench.hpp"
+#include "tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <string>
+
+// Measures what a Sum_augment tree costs and what it buys: insert time against the counting
+// Tree, and range_aggregate against summing the keys between lower_bound and upper_bound. The
+// walk is linear in the range, so it only answers the first walked_queries queries.
+//
+// usage: bench_range_aggregate [queries] [tree sizes...]
+
+namespace {
+
+constexpr std::size_t walked_queries = 200;
+
+using Sum_tree = RB_tree::Augmented_tree<int, RB_tree::Sum_augment<long>>;
+
+template <typename T> double insert_ns(T &tree, const std::vector<int> &keys) {
+    bench::Stopwatch sw;
+    for (int key : keys)
+        tree.insert(key);
+    return sw.elapsed_ms() * 1e6 / static_cast<double>(keys.size());
+}
+
+template <typename F>
+double query_ns(const std::vector<std::pair<int, int>> &queries, long &checksum, F &&query) {
+    checksum = 0;
+    bench::Stopwatch sw;
+    for (auto [lo, hi] : queries)
+        checksum += query(lo, hi);
+    bench::do_not_optimize(checksum);
+    return sw.elapsed_ms() * 1e6 / static_cast<double>(queries.size());
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::size_t n_queries = argc > 1 ? std::stoul(argv[1]) : 100'000;
+    std::vector<std::size_t> sizes;
+    for (int i = 2; i < argc; ++i)
+        sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty())
+        sizes = {10'000, 100'000, 1'000'000};
+
+    for (auto n : sizes) {
+        const int max_key = static_cast<int>(std::min<std::size_t>(n * 10, 1'000'000'000));
+        const auto keys = bench::random_keys(n, max_key);
+        const auto queries = bench::random_queries(n_queries, max_key);
+
+        RB_tree::Tree<int> counting;
+        Sum_tree summing;
+        const double count_insert = insert_ns(counting, keys);
+        const double sum_insert = insert_ns(summing, keys);
+
+        const std::vector walked(queries.begin(),
+                                 queries.begin() + std::min(walked_queries, queries.size()));
+        long linear_sum = 0;
+        long walked_sum = 0;
+        long aggregate_sum = 0;
+        const double linear = query_ns(walked, linear_sum, [&](int lo, int hi) {
+            return std::accumulate(counting.lower_bound(lo), counting.upper_bound(hi), 0L);
+        });
+        query_ns(walked, walked_sum,
+                 [&](int lo, int hi) { return summing.range_aggregate(lo, hi); });
+        const double aggregate = query_ns(queries, aggregate_sum, [&](int lo, int hi) {
+            return summing.range_aggregate(lo, hi);
+        });
+        if (linear_sum != walked_sum) {
+            std::cerr << "checksum mismatch for n = " << n << '\n';
+            return EXIT_FAILURE;
+        }
+
+        std::printf("%10zu  insert %7.1f ns/key counting, %7.1f ns/key summing\n", n,
+                    count_insert, sum_insert);
+        std::printf("%10zu  sum    %10.1f ns/query walking the range, %7.1f ns/query "
+                    "range_aggregate\n",
+                    n, linear, aggregate);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,84 @@
+#include "bench.hpp"
+#include "perf_counters.hpp"
+#include "tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// Compares the old rank path (lower_bound + upper_bound + log_distance, which climbs to the root
+// twice through parent pointers) with the top-down count_in_range descent.
+//
+// usage: bench_rank_descent [queries] [tree sizes...]
+
+namespace {
+
+struct Measurement {
+    double ms;
+    std::uint64_t cache_misses;
+    std::size_t checksum;
+};
+
+template <typename F>
+Measurement measure(const std::vector<std::pair<int, int>> &queries, F &&count) {
+    bench::Perf_counter misses(PERF_COUNT_HW_CACHE_MISSES);
+    std::size_t checksum = 0;
+
+    bench::Stopwatch sw;
+    misses.start();
+    for (auto [fst, snd] : queries)
+        checksum += count(fst, snd);
+    auto cache_misses = misses.stop();
+    auto ms = sw.elapsed_ms();
+
+    bench::do_not_optimize(checksum);
+    return {ms, cache_misses, checksum};
+}
+
+void report(std::size_t n, const char *method, const Measurement &m, std::size_t queries,
+            bool have_counters) {
+    std::printf("%10zu  %-28s %10.2f ms %8.1f ns/query", n, method, m.ms,
+                m.ms * 1e6 / static_cast<double>(queries));
+    if (have_counters)
+        std::printf(" %8.2f misses/query",
+                    static_cast<double>(m.cache_misses) / static_cast<double>(queries));
+    std::printf("\n");
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    std::size_t n_queries = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+    std::vector<std::size_t> sizes;
+    for (int i = 2; i < argc; ++i)
+        sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty())
+        sizes = {10'000, 100'000, 1'000'000};
+
+    const bool have_counters = bench::Perf_counter(PERF_COUNT_HW_CACHE_MISSES).valid();
+    if (!have_counters)
+        std::cerr << "perf_event_open is not permitted, reporting time only\n";
+
+    for (auto n : sizes) {
+        const int max_key = static_cast<int>(n * 10);
+        RB_tree::Tree<int> tree;
+        for (int key : bench::random_keys(n, max_key))
+            tree.insert(key);
+
+        auto queries = bench::random_queries(n_queries, max_key);
+
+        auto old_path = measure(queries, [&](int fst, int snd) {
+            return tree.log_distance(tree.lower_bound(fst), tree.upper_bound(snd));
+        });
+        auto new_path =
+            measure(queries, [&](int fst, int snd) { return tree.count_in_range(fst, snd); });
+
+        if (old_path.checksum != new_path.checksum) {
+            std::cerr << "checksum mismatch for n = " << n << '\n';
+            return EXIT_FAILURE;
+        }
+
+        report(n, "bounds + log_distance", old_path, n_queries, have_counters);
+        report(n, "count_in_range", new_path, n_queries, have_counters);
+    }
+    return EXIT_SUCCESS;
+}
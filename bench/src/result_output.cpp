@@ -0,0 +1,58 @@
+#include "bench.hpp"
+#include "result_writer.hpp"
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unistd.h>
+
+// Writes the same query results to /dev/null with std::ostream << and with Result_writer in text
+// and binary mode, so only formatting and write(2) costs are measured.
+//
+// usage: bench_result_output [results]
+
+int main(int argc, char *argv[]) {
+    const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 10'000'000;
+
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<long> dist(0, 1'000'000);
+    std::vector<long> results(n);
+    for (auto &r : results)
+        r = dist(gen);
+
+    double stream_ms = 0;
+    {
+        std::ofstream null("/dev/null");
+        bench::Stopwatch sw;
+        for (long r : results)
+            null << r << ' ';
+        null << std::endl;
+        stream_ms = sw.elapsed_ms();
+    }
+
+    auto sink_ms = [&](RB_tree::Result_writer::Mode mode) {
+        const int fd = open("/dev/null", O_WRONLY);
+        bench::Stopwatch sw;
+        {
+            RB_tree::Result_writer out(fd, mode);
+            out.put(std::span<const long>(results));
+            out.finish();
+        }
+        const double ms = sw.elapsed_ms();
+        close(fd);
+        return ms;
+    };
+    const double text_ms = sink_ms(RB_tree::Result_writer::Mode::text);
+    const double binary_ms = sink_ms(RB_tree::Result_writer::Mode::binary);
+
+    std::printf("%zu results\n", n);
+    std::printf("std::ostream <<          %9.2f ms  %6.1f ns/result\n", stream_ms,
+                stream_ms * 1e6 / static_cast<double>(n));
+    std::printf("Result_writer text       %9.2f ms  %6.1f ns/result\n", text_ms,
+                text_ms * 1e6 / static_cast<double>(n));
+    std::printf("Result_writer binary     %9.2f ms  %6.1f ns/result\n", binary_ms,
+                binary_ms * 1e6 / static_cast<double>(n));
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+#include "bench.hpp"
+#include "range_query.hpp"
+#include "sharded_tree.hpp"
+#include "thread_pool.hpp"
+#include "tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <span>
+#include <string>
+#include <thread>
+
+// Scales a Sharded_tree from 1 to N shards, each with its ingest worker: inserts the keys in
+// batches as long as a run of 'k' commands the driver collects, then answers the queries with
+// range_query_run on a pool of as many threads as shards. The single Tree row is the baseline
+// (the same batches through Tree::insert_batch on the calling thread). On fewer cores than
+// shards the workers take turns, so the numbers only show the routing overhead.
+//
+// usage: bench_sharded_tree [keys] [queries] [max shards] [batch]
+
+namespace {
+
+constexpr std::size_t run_length = 1 << 16;
+
+template <typename C>
+double ingest_ms(C &tree, const std::vector<int> &keys, std::size_t batch) {
+    bench::Stopwatch sw;
+    for (std::size_t first = 0; first < keys.size(); first += batch)
+        tree.insert_batch(std::span(keys).subspan(first, std::min(batch, keys.size() - first)));
+    return sw.elapsed_ms();
+}
+
+template <typename C>
+double query_ms(const C &tree, const std::vector<std::pair<int, int>> &queries,
+                RB_tree::Thread_pool &pool, long &checksum) {
+    std::vector<long> results(run_length);
+    checksum = 0;
+
+    bench::Stopwatch sw;
+    for (std::size_t first = 0; first < queries.size(); first += run_length) {
+        const auto n = std::min(run_length, queries.size() - first);
+        RB_tree::range_query_run(tree, std::span(queries).subspan(first, n),
+                                 std::span(results).first(n), pool);
+        for (std::size_t i = 0; i < n; ++i)
+            checksum += results[i];
+    }
+    return sw.elapsed_ms();
+}
+
+void report(const char *name, std::size_t shards, std::size_t n, std::size_t q, double insert,
+            double query, double base_insert, double base_query) {
+    std::printf("%-12s %3zu shards  ingest %8.1f ms %6.2f Mkeys/s %5.2fx  query %8.1f ms "
+                "%6.2f Mq/s %5.2fx\n",
+                name, shards, insert, static_cast<double>(n) / insert / 1e3, base_insert / insert,
+                query, static_cast<double>(q) / query / 1e3, base_query / query);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 4'000'000;
+    const std::size_t q = argc > 2 ? std::stoul(argv[2]) : 1'000'000;
+    const std::size_t max_shards =
+        argc > 3 ? std::stoul(argv[3]) : std::max(4u, std::thread::hardware_concurrency());
+    const std::size_t batch = argc > 4 ? std::stoul(argv[4]) : 1 << 16;
+
+    const int max_key = static_cast<int>(std::min<std::size_t>(n * 10, 2e9));
+    const auto keys = bench::random_keys(n, max_key);
+    const auto queries = bench::random_queries(q, max_key);
+    std::printf("%zu keys in batches of %zu, %zu queries, %u cores\n", n, batch, q,
+                std::thread::hardware_concurrency());
+
+    RB_tree::Tree<int> tree;
+    const double base_insert = ingest_ms(tree, keys, batch);
+    RB_tree::Thread_pool serial(1);
+    long base_sum = 0;
+    const double base_query = query_ms(tree, queries, serial, base_sum);
+    report("Tree", 1, n, q, base_insert, base_query, base_insert, base_query);
+
+    for (std::size_t shards = 1; shards <= max_shards; shards *= 2) {
+        RB_tree::Sharded_tree<int> sharded(shards);
+        const double insert = ingest_ms(sharded, keys, batch);
+        RB_tree::Thread_pool pool(shards);
+        long checksum = 0;
+        const double query = query_ms(sharded, queries, pool, checksum);
+        if (checksum != base_sum || sharded.size() != tree.size()) {
+            std::cerr << "answers differ on " << shards << " shards\n";
+            return EXIT_FAILURE;
+        }
+        report("Sharded_tree", shards, n, q, insert, query, base_insert, base_query);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,146 @@
+#include "bench.hpp"
+#include "snapshot.hpp"
+#include "tree.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
+// Compares the ways a restarted process can get its set back: inserting every key again as one
+// insert_batch (what replaying the 'k' commands costs, parsing aside), rebuilding a Tree from a
+// snapshot (map, verify the checksum, Tree::from_sorted) and querying the mapped snapshot in
+// place (map and check the header; verify on top). The snapshot file is written to the working
+// directory, so every restore reads it from the page cache. Sets above max_tree_keys
+// are only saved and mapped, their Tree would not fit in memory.
+//
+// usage: bench_snapshot_restart [queries] [set sizes...]
+
+namespace {
+
+constexpr std::size_t max_tree_keys = 20'000'000; // about 1 GB of nodes
+constexpr const char *path = "bench_snapshot.rqs";
+
+struct File {
+    int fd;
+
+    explicit File(int flags) : fd(open(path, flags, 0644)) {
+        if (fd < 0) {
+            std::perror(path);
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    ~File() { close(fd); }
+};
+
+template <typename F> double time_ms(F &&f) {
+    bench::Stopwatch sw;
+    f();
+    return sw.elapsed_ms();
+}
+
+template <typename S>
+double query_ns(const S &set, const std::vector<std::pair<int, int>> &queries, long &checksum) {
+    checksum = 0;
+    bench::Stopwatch sw;
+    for (auto [lo, hi] : queries)
+        checksum += static_cast<long>(set.count_in_range(lo, hi));
+    bench::do_not_optimize(checksum);
+    return sw.elapsed_ms() * 1e6 / static_cast<double>(queries.size());
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::size_t n_queries = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+    std::vector<std::size_t> sizes;
+    for (int i = 2; i < argc; ++i)
+        sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty())
+        sizes = {1'000'000, 10'000'000, 100'000'000};
+
+    for (auto n : sizes) {
+        const int max_key = static_cast<int>(std::min<std::size_t>(n * 10, 1'000'000'000));
+        auto keys = bench::random_keys(n, max_key);
+        const auto queries = bench::random_queries(n_queries, max_key);
+        const bool with_tree = n <= max_tree_keys;
+
+        double replay_ms = 0;
+        RB_tree::Tree<int> tree;
+        if (with_tree)
+            replay_ms = time_ms([&] { tree.insert_batch(keys); });
+        std::sort(keys.begin(), keys.end());
+
+        double save_ms;
+        {
+            File file(O_WRONLY | O_CREAT | O_TRUNC);
+            save_ms = time_ms([&] {
+                const bool written = with_tree ? RB_tree::write_snapshot(file.fd, tree)
+                                               : RB_tree::write_snapshot(file.fd, keys);
+                if (!written) {
+                    std::perror(path);
+                    std::exit(EXIT_FAILURE);
+                }
+            });
+        }
+        keys = {};
+
+        double rebuild_ms = 0;
+        RB_tree::Tree<int> rebuilt;
+        if (with_tree) {
+            tree = RB_tree::Tree<int>();
+            rebuild_ms = time_ms([&] {
+                File file(O_RDONLY);
+                RB_tree::Snapshot_view<int> view(file.fd);
+                if (!view.verify())
+                    std::exit(EXIT_FAILURE);
+                rebuilt = RB_tree::Tree<int>::from_sorted(view.begin(), view.end());
+            });
+        }
+
+        long first = 0;
+        const double map_ms = time_ms([&] {
+            File file(O_RDONLY);
+            RB_tree::Snapshot_view<int> view(file.fd);
+            if (!view.valid())
+                std::exit(EXIT_FAILURE);
+            first = static_cast<long>(view.count_in_range(queries[0].first, queries[0].second));
+        });
+        bench::do_not_optimize(first);
+
+        File file(O_RDONLY);
+        RB_tree::Snapshot_view<int> view(file.fd);
+        const double verify_ms = time_ms([&] {
+            if (!view.verify())
+                std::exit(EXIT_FAILURE);
+        });
+
+        long view_sum = 0;
+        long tree_sum = 0;
+        const double view_ns = query_ns(view, queries, view_sum);
+        const double tree_ns = with_tree ? query_ns(rebuilt, queries, tree_sum) : 0;
+        if (with_tree && view_sum != tree_sum) {
+            std::cerr << "checksum mismatch for n = " << n << '\n';
+            return EXIT_FAILURE;
+        }
+
+        const auto file_bytes = RB_tree::snapshot::header_size + n * sizeof(int);
+        std::printf("%10zu  snapshot %7.1f MiB  save %8.1f ms\n", n,
+                    static_cast<double>(file_bytes) / (1 << 20), save_ms);
+        if (with_tree)
+            std::printf("%10zu  restart   replay %8.1f ms  rebuild %8.1f ms  map %6.3f ms  "
+                        "map + verify %8.1f ms\n",
+                        n, replay_ms, rebuild_ms, map_ms, map_ms + verify_ms);
+        else
+            std::printf("%10zu  restart   map %6.3f ms  map + verify %8.1f ms\n", n, map_ms,
+                        map_ms + verify_ms);
+        std::printf("%10zu  query     view %8.1f ns", n, view_ns);
+        if (with_tree)
+            std::printf("  Tree %8.1f ns", tree_ns);
+        std::printf("\n");
+    }
+    std::remove(path);
+    return EXIT_SUCCESS;
+}
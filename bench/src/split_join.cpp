@@ -0,0 +1,106 @@
+#include "bench.hpp"
+#include "tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <span>
+#include <string>
+
+// Measures moving keys between trees that share an arena: splitting a tree at its median and
+// joining the halves back against moving the upper half key by key (insert into a new tree,
+// erase from the old one), and merging a second tree of the same size whose keys interleave with
+// the first (or lie above all of them) against inserting its keys one by one and through
+// insert_batch.
+//
+// usage: bench_split_join [tree sizes...]
+
+namespace {
+
+using Tree = RB_tree::Tree<int>;
+
+Tree make_tree(const std::vector<int> &keys, const Tree::allocator_type &alloc) {
+    Tree tree(alloc);
+    tree.insert_batch(keys);
+    return tree;
+}
+
+template <typename F> double time_ms(F &&f) {
+    bench::Stopwatch sw;
+    f();
+    return sw.elapsed_ms();
+}
+
+/// merge, insert and insert_batch of b into a, checked against each other
+bool compare_merges(const char *name, std::size_t n, const std::vector<int> &a_keys,
+                    const std::vector<int> &b_keys) {
+    Tree merged = make_tree(a_keys, Tree::allocator_type());
+    Tree other = make_tree(b_keys, merged.get_allocator());
+    const double merge_ms = time_ms([&] { merged.merge(std::move(other)); });
+
+    Tree inserted = make_tree(a_keys, Tree::allocator_type());
+    const double insert_ms = time_ms([&] {
+        for (int key : b_keys)
+            inserted.insert(key);
+    });
+
+    Tree batched = make_tree(a_keys, Tree::allocator_type());
+    const double batch_ms = time_ms([&] { batched.insert_batch(b_keys); });
+
+    if (!merged.check_invariants() || merged.size() != inserted.size() ||
+        merged.size() != batched.size()) {
+        std::cerr << name << ": results differ for n = " << n << '\n';
+        return false;
+    }
+    std::printf("%10zu  merge %-12s %10.3f ms  insert %9.1f ms  insert_batch %9.1f ms\n", n, name,
+                merge_ms, insert_ms, batch_ms);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i)
+        sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty())
+        sizes = {100'000, 1'000'000, 4'000'000};
+
+    for (auto n : sizes) {
+        const int max_key = static_cast<int>(std::min<std::size_t>(n * 10, 1'000'000'000));
+        auto keys = bench::random_keys(n, max_key);
+
+        Tree tree = make_tree(keys, Tree::allocator_type());
+        const int median = *tree.select(n / 2);
+
+        Tree upper;
+        const double split_ms = time_ms([&] { upper = tree.split(median); });
+        const double join_ms = time_ms([&] { tree.join(std::move(upper)); });
+        if (!tree.check_invariants() || tree.size() != n) {
+            std::cerr << "split and join lost keys for n = " << n << '\n';
+            return EXIT_FAILURE;
+        }
+
+        Tree copied(tree.get_allocator());
+        const double copy_ms = time_ms([&] {
+            for (auto it = tree.lower_bound(median); it != tree.end();) {
+                copied.insert(*it);
+                it = tree.erase(it);
+            }
+        });
+        std::printf("%10zu  split %10.3f ms  join %10.3f ms  move by insert and erase %9.1f ms\n",
+                    n, split_ms, join_ms, copy_ms);
+
+        // two sets of n / 2 keys: every other key of the sorted keys, or the lower and upper half
+        std::sort(keys.begin(), keys.end());
+        std::vector<int> even, odd;
+        for (std::size_t i = 0; i < n; ++i)
+            (i % 2 == 0 ? even : odd).push_back(keys[i]);
+        const std::span<const int> all(keys);
+        const std::vector<int> low(all.begin(), all.begin() + static_cast<long>(n / 2));
+        const std::vector<int> high(all.begin() + static_cast<long>(n / 2), all.end());
+
+        if (!compare_merges("interleaved", n, even, odd) ||
+            !compare_merges("disjoint", n, low, high))
+            return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
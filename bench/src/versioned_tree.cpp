@@ -0,0 +1,93 @@
+#include "bench.hpp"
+#include "tree.hpp"
+#include "versioned_tree.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+
+// Measures what keeping every version costs: insert time and memory per version of a
+// Versioned_tree against the ephemeral Tree, and count_in_range on the latest version, on the
+// version halfway through and on a random past version per query.
+//
+// usage: bench_versioned_tree [queries] [tree sizes...]
+
+namespace {
+
+template <typename T> double insert_ns(T &tree, const std::vector<int> &keys) {
+    bench::Stopwatch sw;
+    for (int key : keys)
+        tree.insert(key);
+    return sw.elapsed_ms() * 1e6 / static_cast<double>(keys.size());
+}
+
+template <typename F>
+double query_ns(const std::vector<std::pair<int, int>> &queries, long &checksum, F &&query) {
+    checksum = 0;
+    bench::Stopwatch sw;
+    for (auto [lo, hi] : queries)
+        checksum += static_cast<long>(query(lo, hi));
+    bench::do_not_optimize(checksum);
+    return sw.elapsed_ms() * 1e6 / static_cast<double>(queries.size());
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const std::size_t n_queries = argc > 1 ? std::stoul(argv[1]) : 1'000'000;
+    std::vector<std::size_t> sizes;
+    for (int i = 2; i < argc; ++i)
+        sizes.push_back(std::stoul(argv[i]));
+    if (sizes.empty())
+        sizes = {10'000, 100'000, 1'000'000};
+
+    for (auto n : sizes) {
+        const int max_key = static_cast<int>(std::min<std::size_t>(n * 10, 1'000'000'000));
+        const auto keys = bench::random_keys(n, max_key);
+        const auto queries = bench::random_queries(n_queries, max_key);
+
+        const auto rss_before = bench::current_rss_kib();
+        RB_tree::Versioned_tree<int> versioned;
+        const double versioned_insert = insert_ns(versioned, keys);
+        const auto versioned_kib = bench::current_rss_kib() - rss_before;
+
+        RB_tree::Tree<int> tree;
+        const double tree_insert = insert_ns(tree, keys);
+
+        long tree_sum = 0;
+        long latest_sum = 0;
+        long half_sum = 0;
+        long random_sum = 0;
+        const double tree_ns = query_ns(queries, tree_sum, [&](int lo, int hi) {
+            return tree.count_in_range(lo, hi);
+        });
+        const double latest_ns = query_ns(queries, latest_sum, [&](int lo, int hi) {
+            return versioned.count_in_range(lo, hi);
+        });
+        const double half_ns = query_ns(queries, half_sum, [&](int lo, int hi) {
+            return versioned.count_in_range(versioned.version() / 2, lo, hi);
+        });
+        std::mt19937_64 gen(7);
+        std::uniform_int_distribution<std::size_t> version(0, versioned.version());
+        const double random_ns = query_ns(queries, random_sum, [&](int lo, int hi) {
+            return versioned.count_in_range(version(gen), lo, hi);
+        });
+
+        if (latest_sum != tree_sum) {
+            std::cerr << "checksum mismatch for n = " << n << '\n';
+            return EXIT_FAILURE;
+        }
+        bench::do_not_optimize(half_sum + random_sum);
+
+        const auto versions = static_cast<double>(versioned.version());
+        std::printf("%10zu  %zu versions, %.1f nodes/version, %.0f bytes/version (rss)\n", n,
+                    versioned.version(), static_cast<double>(versioned.node_count()) / versions,
+                    static_cast<double>(versioned_kib) * 1024 / versions);
+        std::printf("%10zu  insert    Tree %8.1f ns  Versioned_tree %8.1f ns  %5.2fx\n", n,
+                    tree_insert, versioned_insert, versioned_insert / tree_insert);
+        std::printf("%10zu  query     Tree %8.1f ns  latest %8.1f ns  half %8.1f ns  random %8.1f "
+                    "ns\n",
+                    n, tree_ns, latest_ns, half_ns, random_ns);
+    }
+    return EXIT_SUCCESS;
+}
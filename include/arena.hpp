@@ -0,0 +1,166 @@
+#ifndef INCLUDE_ARENA_HPP
+#define INCLUDE_ARENA_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace RB_tree {
+
+/// slab of fixed-size slots: bump allocation inside large chunks plus a free list of returned
+/// slots; all chunks are released at once when the arena dies
+class Arena final {
+  private:
+    struct Free_slot {
+        Free_slot *next;
+    };
+
+    struct Chunk {
+        std::byte *data;
+        std::size_t bytes;
+    };
+
+    static constexpr std::size_t first_chunk_slots = 64;
+    static constexpr std::size_t max_chunk_slots = std::size_t{1} << 16;
+
+    std::size_t slot_size_;
+    std::align_val_t alignment_;
+    std::vector<Chunk> chunks_;
+    std::byte *cursor_{nullptr};
+    std::byte *end_{nullptr};
+    Free_slot *free_list_{nullptr};
+    std::size_t next_chunk_slots_{first_chunk_slots};
+    std::vector<std::unique_ptr<Arena>> siblings_;
+
+  public:
+    Arena(std::size_t size, std::size_t alignment)
+        : slot_size_(round_up(std::max(size, sizeof(Free_slot)),
+                              std::max(alignment, alignof(Free_slot)))),
+          alignment_(static_cast<std::align_val_t>(std::max(alignment, alignof(Free_slot)))) {}
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    ~Arena() {
+        for (auto &chunk : chunks_)
+            ::operator delete(chunk.data, chunk.bytes, alignment_);
+    }
+
+    [[nodiscard]] std::size_t slot_size() const noexcept { return slot_size_; }
+    [[nodiscard]] std::size_t alignment() const noexcept {
+        return static_cast<std::size_t>(alignment_);
+    }
+
+    /// bytes obtained from the system, including slots on the free list
+    [[nodiscard]] std::size_t capacity_bytes() const noexcept {
+        std::size_t total = 0;
+        for (auto &chunk : chunks_)
+            total += chunk.bytes;
+        return total;
+    }
+
+    /// *this when its slots hold size bytes at alignment, otherwise the first sibling arena
+    /// that does, created on demand and owned by *this
+    Arena &fitting(std::size_t size, std::size_t alignment) {
+        auto fits = [&](const Arena &arena) {
+            return arena.slot_size() >= size && arena.alignment() % alignment == 0;
+        };
+        if (fits(*this))
+            return *this;
+        for (auto &sibling : siblings_)
+            if (fits(*sibling))
+                return *sibling;
+        return *siblings_.emplace_back(std::make_unique<Arena>(size, alignment));
+    }
+
+    /// n adjacent slots; a single slot is taken from the free list first
+    void *allocate(std::size_t n) {
+        if (n == 1 && free_list_)
+            return std::exchange(free_list_, free_list_->next);
+
+        const std::size_t bytes = n * slot_size_;
+        if (static_cast<std::size_t>(end_ - cursor_) < bytes)
+            add_chunk(n);
+
+        return std::exchange(cursor_, cursor_ + bytes);
+    }
+
+    /// returns n adjacent slots to the free list, memory stays with the arena
+    void deallocate(void *p, std::size_t n) noexcept {
+        auto *bytes = static_cast<std::byte *>(p);
+        for (std::size_t i = n; i-- > 0;)
+            free_list_ = ::new (bytes + i * slot_size_) Free_slot{free_list_};
+    }
+
+  private:
+    static constexpr std::size_t round_up(std::size_t size, std::size_t alignment) noexcept {
+        return (size + alignment - 1) / alignment * alignment;
+    }
+
+    void add_chunk(std::size_t min_slots) {
+        if (cursor_ != end_)
+            deallocate(cursor_, static_cast<std::size_t>(end_ - cursor_) / slot_size_);
+
+        const std::size_t slots = std::max(min_slots, next_chunk_slots_);
+        next_chunk_slots_ = std::min(next_chunk_slots_ * 2, max_chunk_slots);
+
+        const std::size_t bytes = slots * slot_size_;
+        chunks_.reserve(chunks_.size() + 1);
+        auto *data = static_cast<std::byte *>(::operator new(bytes, alignment_));
+        chunks_.push_back({data, bytes});
+
+        cursor_ = data;
+        end_ = data + bytes;
+    }
+};
+
+/// allocator handle over a shared Arena; copies allocate from and free into the same arena,
+/// which lives until the last copy is destroyed. A rebound copy whose type does not fit the
+/// slots of that arena allocates from a sibling arena the shared one owns, so every handle
+/// rebound from one allocator compares equal to it and A(B(a)) == a
+template <typename T> class Arena_allocator {
+  private:
+    template <typename U> friend class Arena_allocator;
+
+    std::shared_ptr<Arena> root_;
+    Arena *arena_;
+
+  public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    Arena_allocator()
+        : root_(std::make_shared<Arena>(sizeof(T), alignof(T))), arena_(root_.get()) {}
+
+    template <typename U>
+    Arena_allocator(const Arena_allocator<U> &other)
+        : root_(other.root_), arena_(&root_->fitting(sizeof(T), alignof(T))) {}
+
+    [[nodiscard]] T *allocate(std::size_t n) { return static_cast<T *>(arena_->allocate(n)); }
+
+    void deallocate(T *p, std::size_t n) noexcept { arena_->deallocate(p, n); }
+
+    /// true when destroying this handle frees every slot of the arena
+    [[nodiscard]] bool is_sole_owner() const noexcept { return root_.use_count() == 1; }
+
+    [[nodiscard]] const Arena *arena() const noexcept { return arena_; }
+
+    template <typename U> bool operator==(const Arena_allocator<U> &other) const noexcept {
+        return root_ == other.root_;
+    }
+};
+
+/// allocators that hand out blocks from allocate(n) which may be returned one element at a time
+template <typename Alloc> inline constexpr bool is_slab_allocator_v = false;
+template <typename T> inline constexpr bool is_slab_allocator_v<Arena_allocator<T>> = true;
+
+} // namespace RB_tree
+
+#endif // INCLUDE_ARENA_HPP
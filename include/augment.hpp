@@ -0,0 +1,76 @@
+#ifndef INCLUDE_AUGMENT_HPP
+#define INCLUDE_AUGMENT_HPP
+
+#include "node.hpp"
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <utility>
+
+namespace RB_tree {
+
+/// monoid Tree folds over every subtree: identity(), lift(key) for a single key and an
+/// associative combine(a, b) whose a holds the smaller keys
+template <typename P, typename KeyT>
+concept Augment_policy = requires(const KeyT &key, const typename P::value_type &a) {
+    { P::identity() } -> std::convertible_to<typename P::value_type>;
+    { P::lift(key) } -> std::convertible_to<typename P::value_type>;
+    { P::combine(a, a) } -> std::convertible_to<typename P::value_type>;
+};
+
+/// number of keys; the default policy, read from the subtree size every node keeps anyway
+struct Count_augment {
+    using value_type = std::size_t;
+
+    static value_type identity() noexcept { return 0; }
+    template <typename KeyT> static value_type lift(const KeyT &) noexcept { return 1; }
+    static value_type combine(value_type a, value_type b) noexcept { return a + b; }
+};
+
+/// sum of Proj(key)
+template <typename T, typename Proj = std::identity> struct Sum_augment {
+    using value_type = T;
+
+    static T identity() { return T{}; }
+    template <typename KeyT> static T lift(const KeyT &key) { return static_cast<T>(Proj{}(key)); }
+    static T combine(const T &a, const T &b) { return a + b; }
+};
+
+/// smallest Proj(key), numeric_limits<T>::max() over no keys
+template <typename T, typename Proj = std::identity> struct Min_augment {
+    using value_type = T;
+
+    static T identity() { return std::numeric_limits<T>::max(); }
+    template <typename KeyT> static T lift(const KeyT &key) { return static_cast<T>(Proj{}(key)); }
+    static T combine(const T &a, const T &b) { return std::min(a, b); }
+};
+
+/// largest Proj(key), numeric_limits<T>::lowest() over no keys
+template <typename T, typename Proj = std::identity> struct Max_augment {
+    using value_type = T;
+
+    static T identity() { return std::numeric_limits<T>::lowest(); }
+    template <typename KeyT> static T lift(const KeyT &key) { return static_cast<T>(Proj{}(key)); }
+    static T combine(const T &a, const T &b) { return std::max(a, b); }
+};
+
+/// Node that also keeps the Augment fold of its subtree; Tree links and walks it as a Node and
+/// reads the fold through a static_cast
+template <typename KeyT, typename Augment> class Augmented_node final : public Node<KeyT> {
+  public:
+    typename Augment::value_type aggregate_;
+
+    /// constructor for nil-sentinel
+    Augmented_node() : aggregate_(Augment::identity()) {}
+
+    explicit Augmented_node(const KeyT &key, Color color = Color::red)
+        : Node<KeyT>(key, color), aggregate_(Augment::lift(key)) {}
+    explicit Augmented_node(KeyT &&key, Color color = Color::red)
+        : Node<KeyT>(std::move(key), color), aggregate_(Augment::lift(this->get_key())) {}
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_AUGMENT_HPP
@@ -0,0 +1,73 @@
+#ifndef INCLUDE_BPLUS_ITERATOR_HPP
+#define INCLUDE_BPLUS_ITERATOR_HPP
+
+#include "bplus_node.hpp"
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+namespace RB_tree {
+
+/// position in a BPlus_tree: a leaf and a slot in it; end() is one past the last key of the last
+/// leaf, so it can be decremented; any insert or erase invalidates every iterator
+template <typename KeyT> class BPlus_iterator final {
+  public:
+    using leaf_type = BPlus_leaf<KeyT>;
+
+  private:
+    const leaf_type *leaf_{nullptr};
+    std::size_t pos_{0};
+
+  public:
+    using value_type = KeyT;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = const value_type &;
+    using pointer = const value_type *;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    BPlus_iterator() noexcept = default;
+    BPlus_iterator(const leaf_type *leaf, std::size_t pos) noexcept : leaf_{leaf}, pos_{pos} {}
+
+    reference operator*() const {
+        assert(leaf_ && pos_ < leaf_->count);
+        return leaf_->keys[pos_];
+    }
+
+    pointer operator->() const { return std::addressof(**this); }
+
+    BPlus_iterator &operator++() {
+        if (++pos_ == leaf_->count && leaf_->next) {
+            leaf_ = leaf_->next;
+            pos_ = 0;
+        }
+        return *this;
+    }
+
+    BPlus_iterator &operator--() {
+        if (pos_ == 0) {
+            leaf_ = leaf_->prev;
+            pos_ = leaf_->count;
+        }
+        --pos_;
+        return *this;
+    }
+
+    BPlus_iterator operator++(int) {
+        auto tmp = *this;
+        ++(*this);
+        return tmp;
+    }
+    BPlus_iterator operator--(int) {
+        auto tmp = *this;
+        --(*this);
+        return tmp;
+    }
+
+    bool operator==(const BPlus_iterator &) const = default;
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_BPLUS_ITERATOR_HPP
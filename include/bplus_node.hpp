@@ -0,0 +1,51 @@
+#ifndef INCLUDE_BPLUS_NODE_HPP
+#define INCLUDE_BPLUS_NODE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace RB_tree {
+
+/// every B+-tree node fills this many bytes (four cache lines for int keys) and starts on a
+/// cache-line boundary
+inline constexpr std::size_t bplus_node_bytes = 256;
+inline constexpr std::size_t cache_line_bytes = 64;
+
+/// common head of leaves and inner nodes; count is keys in a leaf and children in an inner node
+struct BPlus_node_head {
+    std::uint16_t count = 0;
+    bool leaf = true;
+};
+
+/// leaf of BPlus_tree: sorted keys, chained to its neighbours for iteration
+template <typename KeyT> struct alignas(cache_line_bytes) BPlus_leaf : BPlus_node_head {
+    static constexpr std::size_t capacity =
+        std::max<std::size_t>((bplus_node_bytes - 8 - 2 * sizeof(void *)) / sizeof(KeyT), 4);
+
+    BPlus_leaf *prev = nullptr;
+    BPlus_leaf *next = nullptr;
+    KeyT keys[capacity];
+
+    BPlus_leaf() : BPlus_node_head{0, true} {}
+};
+
+/// inner node of BPlus_tree: keys[i] separates children[i] and children[i + 1] (every key under
+/// children[i + 1] is not less than it, every key under children[i] is less), sizes[i] counts the
+/// keys under children[i]; the separators come first so a search reads one cache line
+template <typename KeyT> struct alignas(cache_line_bytes) BPlus_inner : BPlus_node_head {
+    static constexpr std::size_t capacity = std::max<std::size_t>(
+        (bplus_node_bytes - 8 + sizeof(KeyT)) /
+            (sizeof(KeyT) + sizeof(std::uint32_t) + sizeof(BPlus_node_head *)),
+        4);
+
+    KeyT keys[capacity - 1];
+    std::uint32_t sizes[capacity];
+    BPlus_node_head *children[capacity];
+
+    BPlus_inner() : BPlus_node_head{0, false} {}
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_BPLUS_NODE_HPP
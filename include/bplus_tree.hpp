@@ -0,0 +1,561 @@
+#ifndef INCLUDE_BPLUS_TREE_HPP
+#define INCLUDE_BPLUS_TREE_HPP
+
+#include "bplus_iterator.hpp"
+#include "bplus_node.hpp"
+#include "node_search.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace RB_tree {
+
+/// order-statistic B+-tree with the same interface as Tree: keys live in leaves of a few cache
+/// lines each, inner nodes keep their separators next to the key count of every child, so a
+/// descent costs about log_B(n) cache misses instead of log2(n)
+template <typename KeyT, typename Compare = std::less<KeyT>> class BPlus_tree final {
+  public:
+    using leaf_type = BPlus_leaf<KeyT>;
+    using inner_type = BPlus_inner<KeyT>;
+    using iterator = BPlus_iterator<KeyT>;
+    using size_type = std::size_t;
+
+  private:
+    // a node below the root never holds fewer; two underfull siblings always fit in one node
+    static constexpr std::size_t leaf_min = leaf_type::capacity / 2;
+    static constexpr std::size_t inner_min = inner_type::capacity / 2;
+
+    BPlus_node_head *root_ = nullptr;
+    leaf_type *first_ = nullptr;
+    leaf_type *last_ = nullptr;
+    size_type size_ = 0;
+    Compare comp_;
+
+    /// outcome of an insert into a subtree: whether the key was new and, when the subtree root
+    /// split, its new right sibling with the smallest key under it
+    struct Insert_result {
+        bool inserted = false;
+        BPlus_node_head *right = nullptr;
+        KeyT separator{};
+    };
+
+  public:
+    BPlus_tree() = default;
+    explicit BPlus_tree(const Compare &comp) : comp_(comp) {}
+    ~BPlus_tree() { destroy(root_); }
+
+    BPlus_tree(const BPlus_tree &) = delete;
+    BPlus_tree &operator=(const BPlus_tree &) = delete;
+
+    BPlus_tree(BPlus_tree &&other) noexcept
+        : root_(std::exchange(other.root_, nullptr)), first_(std::exchange(other.first_, nullptr)),
+          last_(std::exchange(other.last_, nullptr)), size_(std::exchange(other.size_, 0)),
+          comp_(std::move(other.comp_)) {}
+
+    BPlus_tree &operator=(BPlus_tree &&other) noexcept {
+        if (this != &other) {
+            destroy(root_);
+            root_ = std::exchange(other.root_, nullptr);
+            first_ = std::exchange(other.first_, nullptr);
+            last_ = std::exchange(other.last_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            comp_ = std::move(other.comp_);
+        }
+        return *this;
+    }
+
+    Compare key_comp() const { return comp_; }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    bool insert(const KeyT &key) {
+        if (!root_)
+            root_ = first_ = last_ = new leaf_type;
+        if (size_ == UINT32_MAX)
+            throw std::length_error("BPlus_tree: too many keys for 32-bit subtree sizes");
+
+        auto result = insert_into(root_, key);
+        if (!result.inserted)
+            return false;
+
+        ++size_;
+        if (result.right) {
+            auto *root = new inner_type;
+            root->count = 2;
+            root->keys[0] = std::move(result.separator);
+            root->children[0] = root_;
+            root->children[1] = result.right;
+            root->sizes[1] = static_cast<std::uint32_t>(subtree_size(result.right));
+            root->sizes[0] = static_cast<std::uint32_t>(size_ - root->sizes[1]);
+            root_ = root;
+        }
+        return true;
+    }
+
+    /// removes key, returns the number of removed keys (0 or 1)
+    size_type erase(const KeyT &key) {
+        if (!root_ || !erase_from(root_, key))
+            return 0;
+
+        --size_;
+        if (!root_->leaf && root_->count == 1) {
+            auto *old = as_inner(root_);
+            root_ = old->children[0];
+            delete old;
+        } else if (root_->leaf && root_->count == 0) {
+            delete as_leaf(root_);
+            root_ = first_ = last_ = nullptr;
+        }
+        return 1;
+    }
+
+    iterator begin() const { return {first_, 0}; }
+    iterator end() const { return last_ ? iterator(last_, last_->count) : iterator(); }
+
+    iterator lower_bound(const KeyT &key) const {
+        const auto *leaf = find_leaf(key);
+        return leaf ? at(leaf, lower_count(leaf->keys, leaf->count, key)) : end();
+    }
+
+    iterator upper_bound(const KeyT &key) const {
+        const auto *leaf = find_leaf(key);
+        return leaf ? at(leaf, upper_count(leaf->keys, leaf->count, key)) : end();
+    }
+
+    /// without parent links the rank of an iterator is found again from the root by its key
+    iterator::difference_type log_distance(iterator first, iterator last) const {
+        if (first == last)
+            return 0;
+
+        return static_cast<iterator::difference_type>(rank_of(last)) -
+               static_cast<iterator::difference_type>(rank_of(first));
+    }
+
+    /// number of keys less than key
+    size_type rank(const KeyT &key) const {
+        size_type rank = 0;
+        const auto *leaf = find_leaf(key, &rank);
+        return leaf ? rank + lower_count(leaf->keys, leaf->count, key) : 0;
+    }
+
+    /// number of keys in [lo, hi]
+    size_type count_in_range(const KeyT &lo, const KeyT &hi) const {
+        if (comp_(hi, lo))
+            return 0;
+
+        return upper_rank(hi) - rank(lo);
+    }
+
+    /// k-th smallest key counting from 0, end() when k >= size()
+    iterator select(size_type k) const {
+        if (k >= size_)
+            return end();
+
+        const auto *node = root_;
+        while (!node->leaf) {
+            const auto *inner = as_inner(node);
+            std::size_t i = 0;
+            for (; k >= inner->sizes[i]; ++i)
+                k -= inner->sizes[i];
+            node = inner->children[i];
+        }
+        return {as_leaf(node), k};
+    }
+
+    /// checks ordering, fill factors, subtree counts, leaf depth and the leaf chain
+    [[nodiscard]] bool check_invariants() const {
+        if (!root_)
+            return size_ == 0 && !first_ && !last_;
+
+        std::vector<const leaf_type *> leaves;
+        if (check_subtree(root_, nullptr, nullptr, true, leaves) == -1 ||
+            subtree_size(root_) != size_)
+            return false;
+
+        if (leaves.front() != first_ || leaves.back() != last_ || first_->prev || last_->next)
+            return false;
+        for (std::size_t i = 0; i + 1 < leaves.size(); ++i)
+            if (leaves[i]->next != leaves[i + 1] || leaves[i + 1]->prev != leaves[i])
+                return false;
+        return true;
+    }
+
+  private:
+    static inner_type *as_inner(BPlus_node_head *node) noexcept {
+        return static_cast<inner_type *>(node);
+    }
+    static const inner_type *as_inner(const BPlus_node_head *node) noexcept {
+        return static_cast<const inner_type *>(node);
+    }
+    static leaf_type *as_leaf(BPlus_node_head *node) noexcept {
+        return static_cast<leaf_type *>(node);
+    }
+    static const leaf_type *as_leaf(const BPlus_node_head *node) noexcept {
+        return static_cast<const leaf_type *>(node);
+    }
+
+    static std::size_t min_count(const BPlus_node_head *node) noexcept {
+        return node->leaf ? leaf_min : inner_min;
+    }
+
+    static size_type subtree_size(const BPlus_node_head *node) noexcept {
+        if (node->leaf)
+            return node->count;
+
+        const auto *inner = as_inner(node);
+        size_type size = 0;
+        for (std::size_t i = 0; i < inner->count; ++i)
+            size += inner->sizes[i];
+        return size;
+    }
+
+    static void destroy(BPlus_node_head *node) noexcept {
+        if (!node)
+            return;
+
+        if (node->leaf) {
+            delete as_leaf(node);
+            return;
+        }
+        auto *inner = as_inner(node);
+        for (std::size_t i = 0; i < inner->count; ++i)
+            destroy(inner->children[i]);
+        delete inner;
+    }
+
+    /// number of keys in [keys, keys + n) less than key
+    std::size_t lower_count(const KeyT *keys, std::size_t n, const KeyT &key) const {
+        return node_lower_count(keys, n, key, comp_);
+    }
+
+    /// number of keys in [keys, keys + n) not greater than key
+    std::size_t upper_count(const KeyT *keys, std::size_t n, const KeyT &key) const {
+        return node_upper_count(keys, n, key, comp_);
+    }
+
+    /// child of inner whose key range holds key
+    std::size_t child_index(const inner_type &inner, const KeyT &key) const {
+        return upper_count(inner.keys, inner.count - 1u, key);
+    }
+
+    /// leaf whose key range holds key, adding the keys of every subtree left of the path to
+    /// *rank; nullptr in an empty tree
+    const leaf_type *find_leaf(const KeyT &key, size_type *rank = nullptr) const {
+        const auto *node = root_;
+        if (!node)
+            return nullptr;
+
+        while (!node->leaf) {
+            const auto *inner = as_inner(node);
+            const auto i = child_index(*inner, key);
+            if (rank)
+                for (std::size_t j = 0; j < i; ++j)
+                    *rank += inner->sizes[j];
+            node = inner->children[i];
+        }
+        return as_leaf(node);
+    }
+
+    /// iterator to slot pos of leaf; one past its last key moves on to the next leaf
+    static iterator at(const leaf_type *leaf, std::size_t pos) noexcept {
+        if (pos == leaf->count && leaf->next)
+            return {leaf->next, 0};
+        return {leaf, pos};
+    }
+
+    size_type upper_rank(const KeyT &key) const {
+        size_type rank = 0;
+        const auto *leaf = find_leaf(key, &rank);
+        return leaf ? rank + upper_count(leaf->keys, leaf->count, key) : 0;
+    }
+
+    size_type rank_of(iterator it) const { return it == end() ? size_ : rank(*it); }
+
+    Insert_result insert_into(BPlus_node_head *node, const KeyT &key) {
+        if (node->leaf)
+            return insert_into_leaf(as_leaf(node), key);
+
+        auto *inner = as_inner(node);
+        const auto i = child_index(*inner, key);
+        auto result = insert_into(inner->children[i], key);
+        if (!result.inserted)
+            return result;
+
+        ++inner->sizes[i];
+        if (!result.right)
+            return result;
+
+        const auto right_size = static_cast<std::uint32_t>(subtree_size(result.right));
+        inner->sizes[i] -= right_size;
+        return insert_child(inner, i + 1, result.right, right_size, std::move(result.separator));
+    }
+
+    Insert_result insert_into_leaf(leaf_type *leaf, const KeyT &key) {
+        const auto pos = lower_count(leaf->keys, leaf->count, key);
+        if (pos < leaf->count && !comp_(key, leaf->keys[pos]))
+            return {};
+
+        if (leaf->count < leaf_type::capacity) {
+            std::move_backward(leaf->keys + pos, leaf->keys + leaf->count,
+                               leaf->keys + leaf->count + 1);
+            leaf->keys[pos] = key;
+            ++leaf->count;
+            return {true};
+        }
+
+        // full: lay the capacity + 1 keys out in order, keep the lower half here
+        constexpr std::size_t total = leaf_type::capacity + 1;
+        constexpr std::size_t keep = total / 2;
+        KeyT all[total];
+        std::move(leaf->keys, leaf->keys + pos, all);
+        all[pos] = key;
+        std::move(leaf->keys + pos, leaf->keys + leaf->count, all + pos + 1);
+
+        auto *right = new leaf_type;
+        std::move(all, all + keep, leaf->keys);
+        std::move(all + keep, all + total, right->keys);
+        leaf->count = keep;
+        right->count = total - keep;
+
+        right->prev = leaf;
+        right->next = leaf->next;
+        if (leaf->next)
+            leaf->next->prev = right;
+        else
+            last_ = right;
+        leaf->next = right;
+        return {true, right, right->keys[0]};
+    }
+
+    /// puts child at slot pos of inner, separated from its left neighbour by separator
+    Insert_result insert_child(inner_type *inner, std::size_t pos, BPlus_node_head *child,
+                               std::uint32_t child_size, KeyT separator) {
+        const std::size_t n = inner->count;
+        if (n < inner_type::capacity) {
+            std::move_backward(inner->keys + pos - 1, inner->keys + n - 1, inner->keys + n);
+            std::copy_backward(inner->sizes + pos, inner->sizes + n, inner->sizes + n + 1);
+            std::copy_backward(inner->children + pos, inner->children + n,
+                               inner->children + n + 1);
+            inner->keys[pos - 1] = std::move(separator);
+            inner->sizes[pos] = child_size;
+            inner->children[pos] = child;
+            ++inner->count;
+            return {true};
+        }
+
+        // full: lay the capacity + 1 children out in order, keep the lower half here and push
+        // the separator between the halves up
+        constexpr std::size_t total = inner_type::capacity + 1;
+        constexpr std::size_t keep = total / 2;
+        KeyT keys[total - 1];
+        std::uint32_t sizes[total];
+        BPlus_node_head *children[total];
+
+        std::move(inner->keys, inner->keys + pos - 1, keys);
+        keys[pos - 1] = std::move(separator);
+        std::move(inner->keys + pos - 1, inner->keys + n - 1, keys + pos);
+        std::copy(inner->sizes, inner->sizes + pos, sizes);
+        sizes[pos] = child_size;
+        std::copy(inner->sizes + pos, inner->sizes + n, sizes + pos + 1);
+        std::copy(inner->children, inner->children + pos, children);
+        children[pos] = child;
+        std::copy(inner->children + pos, inner->children + n, children + pos + 1);
+
+        auto *right = new inner_type;
+        std::move(keys, keys + keep - 1, inner->keys);
+        std::copy(sizes, sizes + keep, inner->sizes);
+        std::copy(children, children + keep, inner->children);
+        inner->count = keep;
+
+        std::move(keys + keep, keys + total - 1, right->keys);
+        std::copy(sizes + keep, sizes + total, right->sizes);
+        std::copy(children + keep, children + total, right->children);
+        right->count = total - keep;
+
+        return {true, right, std::move(keys[keep - 1])};
+    }
+
+    bool erase_from(BPlus_node_head *node, const KeyT &key) {
+        if (node->leaf) {
+            auto *leaf = as_leaf(node);
+            const auto pos = lower_count(leaf->keys, leaf->count, key);
+            if (pos == leaf->count || comp_(key, leaf->keys[pos]))
+                return false;
+            std::move(leaf->keys + pos + 1, leaf->keys + leaf->count, leaf->keys + pos);
+            --leaf->count;
+            return true;
+        }
+
+        auto *inner = as_inner(node);
+        const auto i = child_index(*inner, key);
+        if (!erase_from(inner->children[i], key))
+            return false;
+
+        --inner->sizes[i];
+        if (inner->children[i]->count < min_count(inner->children[i]))
+            rebalance(inner, i);
+        return true;
+    }
+
+    /// refills the underfull child i of parent from a sibling, or merges it with one
+    void rebalance(inner_type *parent, std::size_t i) {
+        const auto spare = [&](std::size_t j) {
+            return parent->children[j]->count > min_count(parent->children[j]);
+        };
+
+        if (i > 0 && spare(i - 1))
+            borrow_from_left(parent, i);
+        else if (i + 1 < parent->count && spare(i + 1))
+            borrow_from_right(parent, i);
+        else
+            merge(parent, i > 0 ? i - 1 : i);
+    }
+
+    /// moves the last key or child of child i - 1 to the front of child i
+    void borrow_from_left(inner_type *parent, std::size_t i) {
+        std::uint32_t moved = 1;
+        if (parent->children[i]->leaf) {
+            auto *left = as_leaf(parent->children[i - 1]);
+            auto *child = as_leaf(parent->children[i]);
+            std::move_backward(child->keys, child->keys + child->count,
+                               child->keys + child->count + 1);
+            child->keys[0] = std::move(left->keys[--left->count]);
+            ++child->count;
+            parent->keys[i - 1] = child->keys[0];
+        } else {
+            auto *left = as_inner(parent->children[i - 1]);
+            auto *child = as_inner(parent->children[i]);
+            const std::size_t n = child->count;
+            std::move_backward(child->keys, child->keys + n - 1, child->keys + n);
+            std::copy_backward(child->sizes, child->sizes + n, child->sizes + n + 1);
+            std::copy_backward(child->children, child->children + n, child->children + n + 1);
+
+            const std::size_t last = left->count - 1u;
+            child->keys[0] = std::move(parent->keys[i - 1]);
+            child->sizes[0] = moved = left->sizes[last];
+            child->children[0] = left->children[last];
+            parent->keys[i - 1] = std::move(left->keys[last - 1]);
+            --left->count;
+            ++child->count;
+        }
+        parent->sizes[i - 1] -= moved;
+        parent->sizes[i] += moved;
+    }
+
+    /// moves the first key or child of child i + 1 to the back of child i
+    void borrow_from_right(inner_type *parent, std::size_t i) {
+        std::uint32_t moved = 1;
+        if (parent->children[i]->leaf) {
+            auto *child = as_leaf(parent->children[i]);
+            auto *right = as_leaf(parent->children[i + 1]);
+            child->keys[child->count++] = std::move(right->keys[0]);
+            std::move(right->keys + 1, right->keys + right->count, right->keys);
+            --right->count;
+            parent->keys[i] = right->keys[0];
+        } else {
+            auto *child = as_inner(parent->children[i]);
+            auto *right = as_inner(parent->children[i + 1]);
+            const std::size_t n = child->count;
+            child->keys[n - 1] = std::move(parent->keys[i]);
+            child->sizes[n] = moved = right->sizes[0];
+            child->children[n] = right->children[0];
+            ++child->count;
+
+            const std::size_t m = right->count;
+            parent->keys[i] = std::move(right->keys[0]);
+            std::move(right->keys + 1, right->keys + m - 1, right->keys);
+            std::copy(right->sizes + 1, right->sizes + m, right->sizes);
+            std::copy(right->children + 1, right->children + m, right->children);
+            --right->count;
+        }
+        parent->sizes[i] += moved;
+        parent->sizes[i + 1] -= moved;
+    }
+
+    /// appends child j + 1 of parent to child j and frees it
+    void merge(inner_type *parent, std::size_t j) {
+        if (parent->children[j]->leaf) {
+            auto *left = as_leaf(parent->children[j]);
+            auto *right = as_leaf(parent->children[j + 1]);
+            std::move(right->keys, right->keys + right->count, left->keys + left->count);
+            left->count += right->count;
+            left->next = right->next;
+            if (right->next)
+                right->next->prev = left;
+            else
+                last_ = left;
+            delete right;
+        } else {
+            auto *left = as_inner(parent->children[j]);
+            auto *right = as_inner(parent->children[j + 1]);
+            const std::size_t n = left->count;
+            const std::size_t m = right->count;
+            left->keys[n - 1] = std::move(parent->keys[j]);
+            std::move(right->keys, right->keys + m - 1, left->keys + n);
+            std::copy(right->sizes, right->sizes + m, left->sizes + n);
+            std::copy(right->children, right->children + m, left->children + n);
+            left->count += right->count;
+            delete right;
+        }
+
+        const std::size_t n = parent->count;
+        parent->sizes[j] += parent->sizes[j + 1];
+        std::move(parent->keys + j + 1, parent->keys + n - 1, parent->keys + j);
+        std::copy(parent->sizes + j + 2, parent->sizes + n, parent->sizes + j + 1);
+        std::copy(parent->children + j + 2, parent->children + n, parent->children + j + 1);
+        --parent->count;
+    }
+
+    /// leaf depth of the subtree, -1 when any invariant is broken
+    int check_subtree(const BPlus_node_head *node, const KeyT *lo, const KeyT *hi, bool is_root,
+                      std::vector<const leaf_type *> &leaves) const {
+        const std::size_t n = node->count;
+        if ((!is_root && n < min_count(node)) || n == 0)
+            return -1;
+
+        if (node->leaf) {
+            const auto *leaf = as_leaf(node);
+            if (n > leaf_type::capacity)
+                return -1;
+            for (std::size_t i = 0; i < n; ++i) {
+                if (i > 0 && !comp_(leaf->keys[i - 1], leaf->keys[i]))
+                    return -1;
+                if ((lo && comp_(leaf->keys[i], *lo)) || (hi && !comp_(leaf->keys[i], *hi)))
+                    return -1;
+            }
+            leaves.push_back(leaf);
+            return 0;
+        }
+
+        const auto *inner = as_inner(node);
+        if (n > inner_type::capacity || (is_root && n < 2))
+            return -1;
+
+        int depth = -1;
+        for (std::size_t i = 0; i < n; ++i) {
+            const KeyT *child_lo = i > 0 ? &inner->keys[i - 1] : lo;
+            const KeyT *child_hi = i + 1 < n ? &inner->keys[i] : hi;
+            if (child_lo && child_hi && !comp_(*child_lo, *child_hi))
+                return -1;
+            if (subtree_size(inner->children[i]) != inner->sizes[i])
+                return -1;
+
+            const int child_depth =
+                check_subtree(inner->children[i], child_lo, child_hi, false, leaves);
+            if (child_depth == -1 || (depth != -1 && child_depth != depth))
+                return -1;
+            depth = child_depth;
+        }
+        return depth + 1;
+    }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_BPLUS_TREE_HPP
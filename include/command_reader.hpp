@@ -0,0 +1,247 @@
+#ifndef INCLUDE_COMMAND_READER_HPP
+#define INCLUDE_COMMAND_READER_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace RB_tree {
+
+/// one record of the command stream: an op letter and its integer arguments
+struct Command {
+    char op = '\0';
+    int args[3] = {0, 0, 0};
+    bool ok = true; // false when the arguments could not be read; the rest of the line is skipped
+};
+
+/// number of integer arguments that follow op, 0 for unknown commands
+inline int command_arity(char op) noexcept {
+    switch (op) {
+    case 'k':
+    case 'd':
+    case 's':
+        return 1;
+    case 'q':
+    case 'p':
+        return 2;
+    case 'v':
+        return 3;
+    default:
+        return 0;
+    }
+}
+
+/// reads commands with std::istream extraction; kept as the reference the fast reader is
+/// compared against
+class Stream_reader final {
+  private:
+    std::istream &in_;
+
+  public:
+    explicit Stream_reader(std::istream &in = std::cin) : in_(in) {}
+
+    bool next(Command &cmd) {
+        if (!(in_ >> cmd.op))
+            return false;
+
+        cmd.ok = true;
+        for (int i = 0, n = command_arity(cmd.op); i < n && cmd.ok; ++i)
+            cmd.ok = static_cast<bool>(in_ >> cmd.args[i]);
+
+        if (!cmd.ok) {
+            in_.clear();
+            in_.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        }
+        return true;
+    }
+};
+
+/// replays commands that were read earlier
+class Command_list_reader final {
+  private:
+    const Command *cur_;
+    const Command *end_;
+
+  public:
+    explicit Command_list_reader(const std::vector<Command> &commands)
+        : cur_(commands.data()), end_(commands.data() + commands.size()) {}
+
+    bool next(Command &cmd) {
+        if (cur_ == end_)
+            return false;
+        cmd = *cur_++;
+        return true;
+    }
+};
+
+/// reads commands straight from a file descriptor: a regular file is mapped whole, anything else
+/// is read in large blocks; integers are scanned by hand, eight digits at a time where possible
+class Command_reader final {
+  private:
+    static constexpr std::size_t block_size = 1 << 20;
+    static constexpr std::size_t max_token = 32; // longer numbers overflow int anyway
+
+    int fd_;
+    const char *cur_ = nullptr;
+    const char *end_ = nullptr;
+    bool eof_ = false;
+
+    std::vector<char> buffer_;
+    void *map_ = nullptr;
+    std::size_t map_size_ = 0;
+
+  public:
+    explicit Command_reader(int fd = STDIN_FILENO, bool allow_mmap = true) : fd_(fd) {
+        struct stat st;
+        if (allow_mmap && fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+            map_size_ = static_cast<std::size_t>(st.st_size);
+            map_ = mmap(nullptr, map_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map_ != MAP_FAILED) {
+                madvise(map_, map_size_, MADV_SEQUENTIAL);
+                cur_ = static_cast<const char *>(map_);
+                end_ = cur_ + map_size_;
+                eof_ = true;
+                return;
+            }
+            map_ = nullptr;
+        }
+        buffer_.resize(block_size);
+        cur_ = end_ = buffer_.data();
+    }
+
+    Command_reader(const Command_reader &) = delete;
+    Command_reader &operator=(const Command_reader &) = delete;
+
+    ~Command_reader() {
+        if (map_)
+            munmap(map_, map_size_);
+    }
+
+    bool next(Command &cmd) {
+        if (!skip_space())
+            return false;
+
+        cmd.op = *cur_++;
+        cmd.ok = true;
+        for (int i = 0, n = command_arity(cmd.op); i < n && cmd.ok; ++i)
+            cmd.ok = skip_space() && scan_int(cmd.args[i]);
+
+        if (!cmd.ok)
+            skip_line();
+        return true;
+    }
+
+  private:
+    /// moves the unread tail to the front of the buffer and appends the next block
+    void refill() {
+        if (eof_)
+            return;
+
+        const auto tail = static_cast<std::size_t>(end_ - cur_);
+        std::memmove(buffer_.data(), cur_, tail);
+        cur_ = buffer_.data();
+        end_ = cur_ + tail;
+
+        while (!eof_ && end_ != buffer_.data() + buffer_.size()) {
+            const auto got = read(fd_, const_cast<char *>(end_),
+                                  static_cast<std::size_t>(buffer_.data() + buffer_.size() - end_));
+            if (got <= 0)
+                eof_ = true;
+            else
+                end_ += got;
+        }
+    }
+
+    /// skips blanks and line breaks, false at the end of input
+    bool skip_space() {
+        for (;;) {
+            while (cur_ != end_ && static_cast<unsigned char>(*cur_) <= ' ')
+                ++cur_;
+            if (cur_ != end_ || eof_)
+                return cur_ != end_;
+            refill();
+        }
+    }
+
+    void skip_line() {
+        for (;;) {
+            const auto *nl = static_cast<const char *>(
+                std::memchr(cur_, '\n', static_cast<std::size_t>(end_ - cur_)));
+            if (nl) {
+                cur_ = nl + 1;
+                return;
+            }
+            cur_ = end_;
+            if (eof_)
+                return;
+            refill();
+        }
+    }
+
+    static bool is_digit(char c) noexcept { return static_cast<unsigned char>(c - '0') < 10; }
+
+    /// true when all eight bytes of chunk are ASCII digits
+    static bool eight_digits(std::uint64_t chunk) noexcept {
+        return ((chunk & 0xF0F0F0F0F0F0F0F0) |
+                (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) ==
+               0x3333333333333333;
+    }
+
+    /// value of eight ASCII digits loaded little-endian, three multiplies instead of eight
+    static std::uint32_t parse_eight_digits(std::uint64_t chunk) noexcept {
+        chunk = ((chunk & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+        chunk = ((chunk & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+        return static_cast<std::uint32_t>(((chunk & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+    }
+
+    bool scan_int(int &value) {
+        if (static_cast<std::size_t>(end_ - cur_) < max_token)
+            refill();
+
+        const char *p = cur_;
+        const bool negative = p != end_ && *p == '-';
+        if (p != end_ && (*p == '-' || *p == '+'))
+            ++p;
+        if (p == end_ || !is_digit(*p))
+            return false;
+
+        std::uint64_t magnitude = 0;
+        if constexpr (std::endian::native == std::endian::little) {
+            if (end_ - p >= 8) {
+                std::uint64_t chunk;
+                std::memcpy(&chunk, p, sizeof(chunk));
+                if (eight_digits(chunk)) {
+                    magnitude = parse_eight_digits(chunk);
+                    p += 8;
+                }
+            }
+        }
+
+        const std::uint64_t limit = std::uint64_t{std::numeric_limits<int>::max()} + negative;
+        bool overflow = false;
+        for (; p != end_ && is_digit(*p); ++p) {
+            magnitude = magnitude * 10 + static_cast<unsigned>(*p - '0');
+            overflow |= magnitude > limit;
+            magnitude = std::min(magnitude, limit + 1);
+        }
+        cur_ = p;
+        if (overflow)
+            return false;
+
+        value = negative ? static_cast<int>(-static_cast<std::int64_t>(magnitude))
+                         : static_cast<int>(magnitude);
+        return true;
+    }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_COMMAND_READER_HPP
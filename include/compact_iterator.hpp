@@ -0,0 +1,88 @@
+#ifndef INCLUDE_COMPACT_ITERATOR_HPP
+#define INCLUDE_COMPACT_ITERATOR_HPP
+
+#include "compact_node.hpp"
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace RB_tree {
+
+template <typename KeyT> class Compact_iterator final {
+  public:
+    using node_type = Compact_node<KeyT>;
+    using index_type = typename node_type::index_type;
+
+  private:
+    const std::vector<node_type> *nodes_{nullptr};
+    index_type index_{node_type::nil};
+
+    const node_type &at(index_type i) const { return (*nodes_)[i]; }
+
+  public:
+    using value_type = KeyT;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = const value_type &;
+    using pointer = const value_type *;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    Compact_iterator() noexcept = default;
+    Compact_iterator(const std::vector<node_type> *nodes, index_type index) noexcept
+        : nodes_{nodes}, index_{index} {}
+
+    reference operator*() const {
+        assert(nodes_ && index_ != node_type::nil);
+        return at(index_).get_key();
+    }
+
+    pointer operator->() const { return std::addressof(**this); }
+
+    Compact_iterator &operator++() {
+        if (at(index_).get_right() != node_type::nil) {
+            index_ = at(index_).get_right();
+            while (at(index_).get_left() != node_type::nil)
+                index_ = at(index_).get_left();
+        } else {
+            auto parent = at(index_).get_parent();
+            while (parent != node_type::nil && at(parent).get_right() == index_)
+                index_ = std::exchange(parent, at(parent).get_parent());
+            index_ = parent;
+        }
+        return *this;
+    }
+
+    Compact_iterator &operator--() {
+        if (at(index_).get_left() != node_type::nil) {
+            index_ = at(index_).get_left();
+            while (at(index_).get_right() != node_type::nil)
+                index_ = at(index_).get_right();
+        } else {
+            auto parent = at(index_).get_parent();
+            while (parent != node_type::nil && at(parent).get_left() == index_)
+                index_ = std::exchange(parent, at(parent).get_parent());
+            index_ = parent;
+        }
+        return *this;
+    }
+
+    Compact_iterator operator++(int) {
+        auto tmp = *this;
+        ++(*this);
+        return tmp;
+    }
+    Compact_iterator operator--(int) {
+        auto tmp = *this;
+        --(*this);
+        return tmp;
+    }
+
+    bool operator==(const Compact_iterator &) const = default;
+
+    index_type get() const noexcept { return index_; }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_COMPACT_ITERATOR_HPP
@@ -0,0 +1,65 @@
+#ifndef INCLUDE_COMPACT_NODE_HPP
+#define INCLUDE_COMPACT_NODE_HPP
+
+#include "node.hpp"
+#include <cstdint>
+#include <utility>
+
+namespace RB_tree {
+
+/// node of Compact_tree: links are 32-bit indices into the tree's node vector, the color lives in
+/// the top bit of the 32-bit subtree size; index 0 is the nil-sentinel
+template <typename KeyT> class Compact_node {
+  public:
+    using index_type = std::uint32_t;
+
+    static constexpr index_type nil = 0;
+    static constexpr std::uint32_t max_size = (std::uint32_t{1} << 31) - 1;
+
+  private:
+    static constexpr std::uint32_t black_bit = std::uint32_t{1} << 31;
+
+    index_type parent_{nil};
+    index_type child_[2]{nil, nil};
+    std::uint32_t size_color_;
+    KeyT key_;
+
+  public:
+    /// constructor for nil-sentinel
+    Compact_node() : size_color_(black_bit), key_() {}
+
+    Compact_node(const KeyT &key, index_type parent)
+        : parent_(parent), size_color_(1), key_(key) {}
+    Compact_node(KeyT &&key, index_type parent)
+        : parent_(parent), size_color_(1), key_(std::move(key)) {}
+
+    [[nodiscard]] bool is_red() const noexcept { return !(size_color_ & black_bit); }
+    [[nodiscard]] bool is_black() const noexcept { return size_color_ & black_bit; }
+
+    [[nodiscard]] Color color() const noexcept { return is_black() ? Color::black : Color::red; }
+    void set_color(Color color) noexcept {
+        size_color_ = (size_color_ & ~black_bit) | (color == Color::black ? black_bit : 0);
+    }
+
+    [[nodiscard]] std::uint32_t size() const noexcept { return size_color_ & ~black_bit; }
+    void set_size(std::uint32_t size) noexcept {
+        size_color_ = (size_color_ & black_bit) | size;
+    }
+
+    [[nodiscard]] index_type get_parent() const noexcept { return parent_; }
+    [[nodiscard]] index_type get_left() const noexcept { return child_[0]; }
+    [[nodiscard]] index_type get_right() const noexcept { return child_[1]; }
+    /// left child for dir == 0, right child for dir == 1
+    [[nodiscard]] index_type get_child(int dir) const noexcept { return child_[dir]; }
+
+    void set_parent(index_type node) noexcept { parent_ = node; }
+    void set_left(index_type node) noexcept { child_[0] = node; }
+    void set_right(index_type node) noexcept { child_[1] = node; }
+    void set_child(int dir, index_type node) noexcept { child_[dir] = node; }
+
+    [[nodiscard]] const KeyT &get_key() const { return key_; }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_COMPACT_NODE_HPP
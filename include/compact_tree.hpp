@@ -0,0 +1,424 @@
+#ifndef INCLUDE_COMPACT_TREE_HPP
+#define INCLUDE_COMPACT_TREE_HPP
+
+#include "compact_iterator.hpp"
+#include "compact_node.hpp"
+#include <cassert>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace RB_tree {
+
+/// red-black order-statistic tree with the same interface as Tree, but with all nodes stored in
+/// one vector and linked by 32-bit indices (20 bytes per node for int keys instead of 40)
+template <typename KeyT, typename Compare = std::less<KeyT>> class Compact_tree final {
+  public:
+    using node_type = Compact_node<KeyT>;
+    using index_type = typename node_type::index_type;
+    using iterator = Compact_iterator<KeyT>;
+    using size_type = std::size_t;
+
+  private:
+    static constexpr index_type nil = node_type::nil;
+
+    std::vector<node_type> nodes_;
+    index_type root_{nil};
+    index_type begin_node{nil};
+    index_type free_head_{nil}; // erased slots, chained through their parent field
+    Compare comp_;
+
+    node_type &at(index_type i) { return nodes_[i]; }
+    const node_type &at(index_type i) const { return nodes_[i]; }
+
+  public:
+    Compact_tree() { nodes_.emplace_back(); }
+
+    Compare key_comp() const { return comp_; }
+
+    size_type size() const noexcept { return at(root_).size(); }
+    bool empty() const noexcept { return root_ == nil; }
+
+    /// reserves storage for n keys so that inserts do not reallocate the node vector
+    void reserve(size_type n) { nodes_.reserve(n + 1); }
+
+    bool insert(const KeyT &key) {
+        index_type parent = nil;
+        index_type current = root_;
+        int dir = 0;
+
+        while (current != nil) {
+            parent = current;
+            if (comp_(key, at(current).get_key()))
+                dir = 0;
+            else if (comp_(at(current).get_key(), key))
+                dir = 1;
+            else
+                return false;
+            current = at(current).get_child(dir);
+        }
+
+        const auto new_node = new_slot(key, parent);
+
+        if (parent == nil)
+            root_ = new_node;
+        else
+            at(parent).set_child(dir, new_node);
+
+        for (auto p = parent; p != nil; p = at(p).get_parent())
+            at(p).set_size(at(p).size() + 1);
+
+        fix_insert(new_node);
+
+        if (begin_node == nil || comp_(key, at(begin_node).get_key()))
+            begin_node = new_node;
+
+        return true;
+    }
+
+    /// removes key, returns the number of removed keys (0 or 1)
+    size_type erase(const KeyT &key) {
+        index_type current = root_;
+        while (current != nil) {
+            if (comp_(key, at(current).get_key()))
+                current = at(current).get_left();
+            else if (comp_(at(current).get_key(), key))
+                current = at(current).get_right();
+            else {
+                erase_node(current);
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    /// removes the key at pos, returns the iterator past it
+    iterator erase(iterator pos) {
+        assert(pos != end());
+        auto next = std::next(pos);
+        erase_node(pos.get());
+        return next;
+    }
+
+    /// checks ordering, coloring, black heights, sizes and parent links of the whole tree
+    [[nodiscard]] bool check_invariants() const {
+        if (root_ == nil)
+            return begin_node == nil;
+        if (at(root_).is_red() || at(root_).get_parent() != nil)
+            return false;
+
+        index_type leftmost = root_;
+        while (at(leftmost).get_left() != nil)
+            leftmost = at(leftmost).get_left();
+
+        return leftmost == begin_node && check_subtree(root_, nullptr, nullptr) != -1;
+    }
+
+    iterator begin() const { return {&nodes_, begin_node}; }
+    iterator end() const { return {&nodes_, nil}; }
+
+    iterator lower_bound(const KeyT &key) const {
+        index_type candidate = nil;
+        index_type current = root_;
+
+        while (current != nil) {
+            if (comp_(at(current).get_key(), key))
+                current = at(current).get_right();
+            else
+                candidate = std::exchange(current, at(current).get_left());
+        }
+        return {&nodes_, candidate};
+    }
+
+    iterator upper_bound(const KeyT &key) const {
+        index_type candidate = nil;
+        index_type current = root_;
+
+        while (current != nil) {
+            if (comp_(key, at(current).get_key()))
+                candidate = std::exchange(current, at(current).get_left());
+            else
+                current = at(current).get_right();
+        }
+        return {&nodes_, candidate};
+    }
+
+    iterator::difference_type log_distance(iterator first, iterator last) const {
+        if (first == last)
+            return 0;
+
+        return static_cast<iterator::difference_type>(get_rank(last.get())) -
+               static_cast<iterator::difference_type>(get_rank(first.get()));
+    }
+
+    /// number of keys less than key
+    size_type rank(const KeyT &key) const {
+        size_type rank = 0;
+        index_type current = root_;
+
+        while (current != nil) {
+            if (comp_(at(current).get_key(), key)) {
+                rank += at(at(current).get_left()).size() + 1;
+                current = at(current).get_right();
+            } else
+                current = at(current).get_left();
+        }
+        return rank;
+    }
+
+    /// number of keys in [lo, hi]
+    size_type count_in_range(const KeyT &lo, const KeyT &hi) const {
+        if (comp_(hi, lo))
+            return 0;
+
+        return upper_rank(hi) - rank(lo);
+    }
+
+    /// k-th smallest key counting from 0, end() when k >= size()
+    iterator select(size_type k) const {
+        index_type current = root_;
+
+        while (current != nil) {
+            const size_type left_size = at(at(current).get_left()).size();
+            if (k < left_size)
+                current = at(current).get_left();
+            else if (k == left_size)
+                return {&nodes_, current};
+            else {
+                k -= left_size + 1;
+                current = at(current).get_right();
+            }
+        }
+        return end();
+    }
+
+  private:
+    size_type upper_rank(const KeyT &key) const {
+        size_type rank = 0;
+        index_type current = root_;
+
+        while (current != nil) {
+            if (comp_(key, at(current).get_key()))
+                current = at(current).get_left();
+            else {
+                rank += at(at(current).get_left()).size() + 1;
+                current = at(current).get_right();
+            }
+        }
+        return rank;
+    }
+
+    size_type get_rank(index_type node) const {
+        if (node == nil)
+            return size();
+
+        size_type rank = at(at(node).get_left()).size();
+        for (auto current = node; at(current).get_parent() != nil;) {
+            const auto parent = at(current).get_parent();
+            if (current == at(parent).get_right())
+                rank += 1 + at(at(parent).get_left()).size();
+            current = parent;
+        }
+        return rank;
+    }
+
+    /// black height of the subtree, -1 when any invariant is broken
+    int check_subtree(index_type node, const KeyT *lo, const KeyT *hi) const {
+        if (node == nil)
+            return 0;
+
+        const auto &n = at(node);
+        const auto left = n.get_left();
+        const auto right = n.get_right();
+
+        if ((lo && !comp_(*lo, n.get_key())) || (hi && !comp_(n.get_key(), *hi)))
+            return -1;
+        if (n.size() != 1 + at(left).size() + at(right).size())
+            return -1;
+        if ((left != nil && at(left).get_parent() != node) ||
+            (right != nil && at(right).get_parent() != node))
+            return -1;
+        if (n.is_red() && (at(left).is_red() || at(right).is_red()))
+            return -1;
+
+        const int left_height = check_subtree(left, lo, &n.get_key());
+        const int right_height = check_subtree(right, &n.get_key(), hi);
+        if (left_height == -1 || left_height != right_height)
+            return -1;
+
+        return left_height + (n.is_black() ? 1 : 0);
+    }
+
+    index_type new_slot(const KeyT &key, index_type parent) {
+        if (free_head_ != nil) {
+            const auto slot = std::exchange(free_head_, at(free_head_).get_parent());
+            at(slot) = node_type(key, parent);
+            return slot;
+        }
+
+        if (nodes_.size() > node_type::max_size)
+            throw std::length_error("Compact_tree: too many keys for 31-bit subtree sizes");
+
+        nodes_.emplace_back(key, parent);
+        return static_cast<index_type>(nodes_.size() - 1);
+    }
+
+    /// puts v in the place of u in u's parent; the nil-sentinel never gets a parent
+    void transplant(index_type u, index_type v) {
+        const auto parent = at(u).get_parent();
+        if (parent == nil)
+            root_ = v;
+        else
+            at(parent).set_child(direction(u), v);
+
+        if (v != nil)
+            at(v).set_parent(parent);
+    }
+
+    void erase_node(index_type node) {
+        if (node == begin_node)
+            begin_node = std::next(iterator(&nodes_, node)).get();
+
+        index_type x;
+        index_type x_parent;
+        bool removed_black = at(node).is_black();
+
+        if (at(node).get_left() == nil || at(node).get_right() == nil) {
+            x = at(node).get_left() == nil ? at(node).get_right() : at(node).get_left();
+            x_parent = at(node).get_parent();
+            transplant(node, x);
+        } else {
+            auto successor = at(node).get_right();
+            while (at(successor).get_left() != nil)
+                successor = at(successor).get_left();
+
+            removed_black = at(successor).is_black();
+            x = at(successor).get_right();
+
+            if (at(successor).get_parent() == node)
+                x_parent = successor;
+            else {
+                x_parent = at(successor).get_parent();
+                transplant(successor, x);
+                at(successor).set_right(at(node).get_right());
+                at(at(successor).get_right()).set_parent(successor);
+            }
+
+            transplant(node, successor);
+            at(successor).set_left(at(node).get_left());
+            at(at(successor).get_left()).set_parent(successor);
+            at(successor).set_color(at(node).color());
+            at(successor).set_size(at(node).size());
+        }
+
+        for (auto p = x_parent; p != nil; p = at(p).get_parent())
+            at(p).set_size(at(p).size() - 1);
+
+        if (removed_black)
+            fix_erase(x, x_parent);
+
+        at(node) = node_type();
+        at(node).set_parent(std::exchange(free_head_, node));
+    }
+
+    void fix_erase(index_type x, index_type parent) {
+        while (x != root_ && at(x).is_black()) {
+            const int side = (x == at(parent).get_left()) ? 0 : 1;
+            auto sibling = at(parent).get_child(1 - side);
+
+            if (at(sibling).is_red()) {
+                at(sibling).set_color(Color::black);
+                at(parent).set_color(Color::red);
+                rotate(parent, 1 - side);
+                sibling = at(parent).get_child(1 - side);
+            }
+
+            if (at(at(sibling).get_child(side)).is_black() &&
+                at(at(sibling).get_child(1 - side)).is_black()) {
+                at(sibling).set_color(Color::red);
+                x = parent;
+                parent = at(x).get_parent();
+                continue;
+            }
+
+            if (at(at(sibling).get_child(1 - side)).is_black()) {
+                at(at(sibling).get_child(side)).set_color(Color::black);
+                at(sibling).set_color(Color::red);
+                rotate(sibling, side);
+                sibling = at(parent).get_child(1 - side);
+            }
+
+            at(sibling).set_color(at(parent).color());
+            at(parent).set_color(Color::black);
+            at(at(sibling).get_child(1 - side)).set_color(Color::black);
+            rotate(parent, 1 - side);
+            x = root_;
+        }
+
+        if (x != nil)
+            at(x).set_color(Color::black);
+    }
+
+    int direction(index_type node) const {
+        return node == at(at(node).get_parent()).get_right() ? 1 : 0;
+    }
+
+    /// lifts node's child on side dir into node's place
+    void rotate(index_type node, int dir) {
+        const auto child = at(node).get_child(dir);
+        assert(child != nil);
+        const auto inner = at(child).get_child(1 - dir);
+
+        at(node).set_child(dir, inner);
+        if (inner != nil)
+            at(inner).set_parent(node);
+
+        const auto parent = at(node).get_parent();
+        at(child).set_parent(parent);
+        if (parent == nil)
+            root_ = child;
+        else
+            at(parent).set_child(direction(node), child);
+
+        at(child).set_child(1 - dir, node);
+        at(node).set_parent(child);
+
+        at(child).set_size(at(node).size());
+        at(node).set_size(1 + at(at(node).get_left()).size() + at(at(node).get_right()).size());
+    }
+
+    void fix_insert(index_type node) {
+        while (at(at(node).get_parent()).is_red()) {
+            auto parent = at(node).get_parent();
+            const auto grand_parent = at(parent).get_parent();
+            const int side = direction(parent);
+            const auto uncle = at(grand_parent).get_child(1 - side);
+
+            if (at(uncle).is_red()) {
+                at(parent).set_color(Color::black);
+                at(uncle).set_color(Color::black);
+                at(grand_parent).set_color(Color::red);
+                node = grand_parent;
+                continue;
+            }
+
+            if (direction(node) != side) {
+                rotate(parent, 1 - side);
+                node = parent;
+                parent = at(node).get_parent();
+            }
+
+            at(parent).set_color(Color::black);
+            at(grand_parent).set_color(Color::red);
+            rotate(grand_parent, side);
+        }
+
+        at(root_).set_color(Color::black);
+    }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_COMPACT_TREE_HPP
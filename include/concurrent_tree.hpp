@@ -0,0 +1,217 @@
+#ifndef INCLUDE_CONCURRENT_TREE_HPP
+#define INCLUDE_CONCURRENT_TREE_HPP
+
+#include "arena.hpp"
+#include "persistent_node.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace RB_tree {
+
+/// order-statistic red-black tree for many readers and one writer at a time: insert copies the
+/// search path and publishes a new root, readers pin an epoch and walk whichever root they saw,
+/// and replaced nodes are freed once no pinned reader can still reach them
+template <typename KeyT, typename Compare = std::less<KeyT>,
+          typename Allocator = Arena_allocator<KeyT>>
+class Concurrent_tree final {
+  public:
+    using node_type = Persistent_node<KeyT>;
+    using size_type = std::size_t;
+
+    class Snapshot;
+
+  private:
+    /// per-reader epoch announcement; slots are recycled but never freed while the tree lives
+    struct Reader_slot {
+        std::atomic<std::uint64_t> epoch{0}; // 0 while the reader is not pinned
+        std::atomic<bool> in_use{false};
+        Reader_slot *next = nullptr;
+    };
+
+    struct Retired {
+        std::uint64_t epoch;
+        const node_type *node;
+    };
+
+    Path_copier<KeyT, Compare, Allocator> copier_;
+    std::atomic<const node_type *> root_{nullptr};
+    std::atomic<std::uint64_t> epoch_{1};
+    mutable std::atomic<Reader_slot *> readers_{nullptr};
+
+    mutable std::mutex writer_mutex_;
+    std::vector<const node_type *> replaced_;
+    std::vector<Retired> retired_;
+    Compare comp_;
+
+    static constexpr size_type reclaim_threshold = 1024;
+
+  public:
+    Concurrent_tree() = default;
+    explicit Concurrent_tree(const Allocator &alloc) : copier_(alloc) {}
+
+    Concurrent_tree(const Concurrent_tree &) = delete;
+    Concurrent_tree &operator=(const Concurrent_tree &) = delete;
+
+    /// every Snapshot must be gone by now
+    ~Concurrent_tree() {
+        copier_.destroy_subtree(root_.load(std::memory_order_relaxed));
+        for (auto &retired : retired_)
+            copier_.destroy_node(retired.node);
+
+        for (auto *slot = readers_.load(std::memory_order_relaxed); slot;) {
+            assert(!slot->in_use.load(std::memory_order_relaxed));
+            delete std::exchange(slot, slot->next);
+        }
+    }
+
+    Compare key_comp() const { return comp_; }
+
+    /// consistent read-only view of the tree as of this call; it never blocks, and it keeps
+    /// every node it can reach alive until it is destroyed
+    Snapshot snapshot() const { return Snapshot(*this); }
+
+    /// writers are serialized among themselves but never wait for readers
+    bool insert(const KeyT &key) {
+        std::lock_guard lock(writer_mutex_);
+
+        const auto *old_root = root_.load(std::memory_order_relaxed);
+        replaced_.clear();
+        const auto *new_root = copier_.insert(old_root, key, replaced_);
+        if (new_root == old_root)
+            return false;
+
+        root_.store(new_root, std::memory_order_seq_cst);
+
+        const auto epoch = epoch_.load(std::memory_order_relaxed);
+        for (const auto *node : replaced_)
+            retired_.push_back({epoch, node});
+        epoch_.fetch_add(1, std::memory_order_seq_cst);
+
+        if (retired_.size() >= reclaim_threshold)
+            reclaim();
+        return true;
+    }
+
+    size_type size() const { return snapshot().size(); }
+    bool empty() const { return size() == 0; }
+
+    size_type count_in_range(const KeyT &lo, const KeyT &hi) const {
+        return snapshot().count_in_range(lo, hi);
+    }
+
+    /// nodes waiting for readers that still may see them
+    size_type retired_count() const {
+        std::lock_guard lock(writer_mutex_);
+        return retired_.size();
+    }
+
+  private:
+    /// frees every node retired before the oldest epoch still pinned by a reader
+    void reclaim() {
+        auto oldest = epoch_.load(std::memory_order_seq_cst);
+        for (auto *slot = readers_.load(std::memory_order_acquire); slot; slot = slot->next)
+            if (const auto pinned = slot->epoch.load(std::memory_order_seq_cst); pinned != 0)
+                oldest = std::min(oldest, pinned);
+
+        auto kept = std::partition(retired_.begin(), retired_.end(),
+                                   [&](const Retired &r) { return r.epoch >= oldest; });
+        for (auto it = kept; it != retired_.end(); ++it)
+            copier_.destroy_node(it->node);
+        retired_.erase(kept, retired_.end());
+    }
+
+    /// a free slot, or a new one pushed onto the list; lock-free so that readers never wait
+    Reader_slot *acquire_slot() const {
+        for (auto *slot = readers_.load(std::memory_order_acquire); slot; slot = slot->next) {
+            bool expected = false;
+            if (!slot->in_use.load(std::memory_order_relaxed) &&
+                slot->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                return slot;
+        }
+
+        auto *slot = new Reader_slot;
+        slot->in_use.store(true, std::memory_order_relaxed);
+        slot->next = readers_.load(std::memory_order_relaxed);
+        while (!readers_.compare_exchange_weak(slot->next, slot, std::memory_order_release,
+                                               std::memory_order_relaxed)) {
+        }
+        return slot;
+    }
+
+  public:
+    class Snapshot final {
+      private:
+        const Concurrent_tree *tree_;
+        Reader_slot *slot_;
+        const node_type *root_;
+
+        friend class Concurrent_tree;
+
+        explicit Snapshot(const Concurrent_tree &tree) : tree_(&tree), slot_(tree.acquire_slot()) {
+            // announcing the epoch before loading the root pairs with the writer publishing the
+            // root before reading the announcements (both seq_cst): a reader the writer missed is
+            // guaranteed to load the new root
+            slot_->epoch.store(tree.epoch_.load(std::memory_order_seq_cst),
+                               std::memory_order_seq_cst);
+            root_ = tree.root_.load(std::memory_order_seq_cst);
+        }
+
+      public:
+        Snapshot(Snapshot &&other) noexcept
+            : tree_(other.tree_), slot_(std::exchange(other.slot_, nullptr)), root_(other.root_) {}
+
+        Snapshot(const Snapshot &) = delete;
+        Snapshot &operator=(const Snapshot &) = delete;
+        Snapshot &operator=(Snapshot &&) = delete;
+
+        ~Snapshot() {
+            if (!slot_)
+                return;
+            slot_->epoch.store(0, std::memory_order_release);
+            slot_->in_use.store(false, std::memory_order_release);
+        }
+
+        size_type size() const noexcept { return node_type::size_of(root_); }
+        bool empty() const noexcept { return root_ == nullptr; }
+
+        /// number of keys less than key
+        size_type rank(const KeyT &key) const {
+            return persistent_rank(root_, key, tree_->comp_);
+        }
+
+        /// number of keys in [lo, hi], 0 when hi < lo
+        size_type count_in_range(const KeyT &lo, const KeyT &hi) const {
+            if (tree_->comp_(hi, lo))
+                return 0;
+            return persistent_upper_rank(root_, hi, tree_->comp_) -
+                   persistent_rank(root_, lo, tree_->comp_);
+        }
+
+        /// first key not less than key, nullptr if none; valid while the snapshot lives
+        const KeyT *lower_bound(const KeyT &key) const {
+            return persistent_lower_bound(root_, key, tree_->comp_);
+        }
+
+        /// first key greater than key, nullptr if none; valid while the snapshot lives
+        const KeyT *upper_bound(const KeyT &key) const {
+            return persistent_upper_bound(root_, key, tree_->comp_);
+        }
+
+        /// k-th smallest key counting from 0, nullptr when k >= size()
+        const KeyT *select(size_type k) const { return persistent_select(root_, k); }
+
+        bool check_invariants() const {
+            return !node_type::is_red(root_) && persistent_check(root_, tree_->comp_) > 0;
+        }
+    };
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_CONCURRENT_TREE_HPP
@@ -0,0 +1,126 @@
+#ifndef INCLUDE_EYTZINGER_INDEX_HPP
+#define INCLUDE_EYTZINGER_INDEX_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+namespace RB_tree {
+
+/// allocator handing out storage aligned to a cache line
+template <typename T> struct Cache_aligned_allocator {
+    using value_type = T;
+    static constexpr std::align_val_t alignment{64};
+
+    Cache_aligned_allocator() = default;
+    template <typename U> Cache_aligned_allocator(const Cache_aligned_allocator<U> &) noexcept {}
+
+    T *allocate(std::size_t n) {
+        return static_cast<T *>(::operator new(n * sizeof(T), alignment));
+    }
+    void deallocate(T *p, std::size_t) noexcept { ::operator delete(p, alignment); }
+
+    template <typename U> bool operator==(const Cache_aligned_allocator<U> &) const noexcept {
+        return true;
+    }
+};
+
+/// immutable copy of a sorted key sequence in Eytzinger (BFS) order: the children of slot k sit
+/// at 2k and 2k + 1, so a search walks one array top-down with no branches on the comparison,
+/// and the slots four levels below are prefetched while the current level is compared
+template <typename KeyT, typename Compare = std::less<KeyT>> class Eytzinger_index final {
+  public:
+    using size_type = std::size_t;
+
+  private:
+    std::vector<KeyT, Cache_aligned_allocator<KeyT>> keys_; // slot 0 unused
+    std::vector<std::uint32_t> rank_;                       // sorted position of slot k
+    Compare comp_;
+
+    // a cache line holds this many keys; prefetching slot k * lookahead fetches the whole
+    // group of descendants four levels down for int keys
+    static constexpr size_type lookahead = std::max<size_type>(64 / sizeof(KeyT), 1);
+
+  public:
+    Eytzinger_index() : keys_(1), rank_(1) {}
+
+    /// first must walk n keys sorted by comp
+    template <std::input_iterator It>
+    Eytzinger_index(It first, size_type n, const Compare &comp = Compare())
+        : keys_(n + 1), rank_(n + 1), comp_(comp) {
+        if (n > UINT32_MAX)
+            throw std::length_error("Eytzinger_index: more than 2^32 - 1 keys");
+        std::uint32_t next_rank = 0;
+        fill(first, next_rank, 1);
+    }
+
+    /// freezes the current contents of any sorted container
+    template <typename C>
+        requires requires(const C &c) {
+            c.begin();
+            c.key_comp();
+        }
+    explicit Eytzinger_index(const C &sorted)
+        : Eytzinger_index(sorted.begin(), sorted.size(), sorted.key_comp()) {}
+
+    Compare key_comp() const { return comp_; }
+
+    size_type size() const noexcept { return keys_.size() - 1; }
+    bool empty() const noexcept { return size() == 0; }
+
+    /// number of keys less than key
+    size_type rank(const KeyT &key) const {
+        return to_rank(descend([&](const KeyT &slot) { return comp_(slot, key); }));
+    }
+
+    /// number of keys not greater than key
+    size_type upper_rank(const KeyT &key) const {
+        return to_rank(descend([&](const KeyT &slot) { return !comp_(key, slot); }));
+    }
+
+    /// number of keys in [lo, hi], 0 when hi < lo
+    size_type count_in_range(const KeyT &lo, const KeyT &hi) const {
+        if (comp_(hi, lo))
+            return 0;
+        return upper_rank(hi) - rank(lo);
+    }
+
+  private:
+    /// writes the sorted keys in in-order position of the implicit tree rooted at slot k
+    template <typename It> void fill(It &it, std::uint32_t &next_rank, size_type k) {
+        if (k > size())
+            return;
+        fill(it, next_rank, 2 * k);
+        keys_[k] = *it;
+        ++it;
+        rank_[k] = next_rank++;
+        fill(it, next_rank, 2 * k + 1);
+    }
+
+    /// slot of the first key for which go_right is false, 0 when there is none
+    template <typename GoRight> size_type descend(GoRight go_right) const {
+        const auto n = size();
+        const KeyT *base = keys_.data();
+        size_type k = 1;
+        while (k <= n) {
+            __builtin_prefetch(base + std::min(k * lookahead, n));
+            k = 2 * k + static_cast<size_type>(go_right(base[k]));
+        }
+        // the answer is the last slot where the walk turned left: strip the trailing right turns
+        // and that left turn
+        return k >> (std::countr_one(k) + 1);
+    }
+
+    size_type to_rank(size_type slot) const noexcept { return slot ? rank_[slot] : size(); }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_EYTZINGER_INDEX_HPP
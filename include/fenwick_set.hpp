@@ -0,0 +1,132 @@
+#ifndef INCLUDE_FENWICK_SET_HPP
+#define INCLUDE_FENWICK_SET_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace RB_tree {
+
+/// order-statistic set over a key universe known up front: keys are coordinate-compressed once,
+/// and presence counts live in a Fenwick tree, so every operation is a few passes over one flat
+/// array; meant for offline replays where the whole command stream has been read already
+template <typename KeyT, typename Compare = std::less<KeyT>> class Fenwick_set final {
+  public:
+    using size_type = std::size_t;
+
+  private:
+    std::vector<KeyT> keys_;          // the universe, sorted and unique
+    std::vector<std::uint32_t> tree_; // 1-based Fenwick tree of presence counts
+    std::vector<bool> present_;
+    size_type size_ = 0;
+    Compare comp_;
+
+  public:
+    /// universe may hold repeats and come in any order
+    explicit Fenwick_set(std::vector<KeyT> universe, const Compare &comp = Compare())
+        : keys_(std::move(universe)), comp_(comp) {
+        std::sort(keys_.begin(), keys_.end(), comp_);
+        keys_.erase(std::unique(keys_.begin(), keys_.end(),
+                                [&](const KeyT &a, const KeyT &b) { return !comp_(a, b); }),
+                    keys_.end());
+        if (keys_.size() > UINT32_MAX)
+            throw std::length_error("Fenwick_set: universe exceeds 2^32 - 1 keys");
+        tree_.assign(keys_.size() + 1, 0);
+        present_.assign(keys_.size(), false);
+    }
+
+    Compare key_comp() const { return comp_; }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    /// keys the set can hold
+    size_type universe_size() const noexcept { return keys_.size(); }
+
+    /// throws std::out_of_range for keys outside the universe
+    bool insert(const KeyT &key) {
+        const auto i = index_of(key);
+        if (i == keys_.size())
+            throw std::out_of_range("Fenwick_set: key is not in the universe");
+        if (present_[i])
+            return false;
+        present_[i] = true;
+        add(i, 1);
+        return true;
+    }
+
+    size_type erase(const KeyT &key) {
+        const auto i = index_of(key);
+        if (i == keys_.size() || !present_[i])
+            return 0;
+        present_[i] = false;
+        add(i, -1);
+        return 1;
+    }
+
+    /// number of keys less than key
+    size_type rank(const KeyT &key) const { return prefix(lower_index(key)); }
+
+    /// number of keys in [lo, hi], 0 when hi < lo
+    size_type count_in_range(const KeyT &lo, const KeyT &hi) const {
+        if (comp_(hi, lo))
+            return 0;
+        return prefix(upper_index(hi)) - prefix(lower_index(lo));
+    }
+
+    /// k-th smallest key counting from 0, nullptr when k >= size()
+    const KeyT *select(size_type k) const {
+        if (k >= size_)
+            return nullptr;
+
+        // binary lifting: the largest position whose prefix count is still <= k
+        size_type pos = 0;
+        for (auto step = std::bit_floor(keys_.size()); step != 0; step >>= 1) {
+            if (pos + step < tree_.size() && tree_[pos + step] <= k) {
+                pos += step;
+                k -= tree_[pos];
+            }
+        }
+        return &keys_[pos];
+    }
+
+  private:
+    size_type lower_index(const KeyT &key) const {
+        return static_cast<size_type>(
+            std::lower_bound(keys_.begin(), keys_.end(), key, comp_) - keys_.begin());
+    }
+
+    size_type upper_index(const KeyT &key) const {
+        return static_cast<size_type>(
+            std::upper_bound(keys_.begin(), keys_.end(), key, comp_) - keys_.begin());
+    }
+
+    /// position of key in the universe, universe_size() when it is not there
+    size_type index_of(const KeyT &key) const {
+        const auto i = lower_index(key);
+        return i != keys_.size() && !comp_(key, keys_[i]) ? i : keys_.size();
+    }
+
+    void add(size_type i, int delta) noexcept {
+        size_ += static_cast<size_type>(delta);
+        for (++i; i < tree_.size(); i += i & (~i + 1))
+            tree_[i] += static_cast<std::uint32_t>(delta);
+    }
+
+    /// number of present keys among the first n of the universe
+    size_type prefix(size_type n) const noexcept {
+        size_type sum = 0;
+        for (; n != 0; n &= n - 1)
+            sum += tree_[n];
+        return sum;
+    }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_FENWICK_SET_HPP
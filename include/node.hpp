@@ -11,8 +11,7 @@ enum class Color : bool { red, black };
 template <typename KeyT> class Node {
   private:
     Node *parent_{nullptr};
-    Node *left_{nullptr};
-    Node *right_{nullptr};
+    Node *child_[2]{nullptr, nullptr}; // left, right: a descent indexes it with a comparison
     KeyT key_;
 
   public:
@@ -26,7 +25,7 @@ template <typename KeyT> class Node {
     ~Node() = default;
 
     /// constructor for nil-sentinel
-    Node() : parent_(this), left_(this), right_(this), color_(Color::black), size_(0) {}
+    Node() : parent_(this), child_{this, this}, color_(Color::black), size_(0) {}
 
     explicit Node(const KeyT &key, Color color = Color::red) : key_(key), color_(color), size_(1) {}
     explicit Node(KeyT &&key, Color color = Color::red)
@@ -35,18 +34,21 @@ template <typename KeyT> class Node {
     [[nodiscard]] bool is_red() const noexcept { return color_ == Color::red; }
     [[nodiscard]] bool is_black() const noexcept { return color_ == Color::black; }
 
-    void set_left(Node *node) noexcept { left_ = node; }
-    void set_right(Node *node) noexcept { right_ = node; }
+    void set_left(Node *node) noexcept { child_[0] = node; }
+    void set_right(Node *node) noexcept { child_[1] = node; }
 
     void set_parent(Node *node) noexcept { parent_ = node; }
 
     [[nodiscard]] Node *get_parent() noexcept { return parent_; }
-    [[nodiscard]] Node *get_left() noexcept { return left_; }
-    [[nodiscard]] Node *get_right() noexcept { return right_; }
+    [[nodiscard]] Node *get_left() noexcept { return child_[0]; }
+    [[nodiscard]] Node *get_right() noexcept { return child_[1]; }
 
     [[nodiscard]] const Node *get_parent() const noexcept { return parent_; }
-    [[nodiscard]] const Node *get_left() const noexcept { return left_; }
-    [[nodiscard]] const Node *get_right() const noexcept { return right_; }
+    [[nodiscard]] const Node *get_left() const noexcept { return child_[0]; }
+    [[nodiscard]] const Node *get_right() const noexcept { return child_[1]; }
+
+    /// right child when right is true, left child otherwise; no branch on right
+    [[nodiscard]] const Node *get_child(bool right) const noexcept { return child_[right]; }
 
     [[nodiscard]] const KeyT &get_key() const { return key_; }
 
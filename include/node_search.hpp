@@ -0,0 +1,177 @@
+#ifndef INCLUDE_NODE_SEARCH_HPP
+#define INCLUDE_NODE_SEARCH_HPP
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define RB_TREE_X86_KERNELS 1
+#endif
+
+namespace RB_tree {
+
+/// instruction sets the in-node search kernels are written for, weakest first
+enum class Isa { scalar, sse42, avx2 };
+
+/// best kernel level the running CPU supports
+inline Isa detect_isa() noexcept {
+#ifdef RB_TREE_X86_KERNELS
+    if (__builtin_cpu_supports("avx2"))
+        return Isa::avx2;
+    if (__builtin_cpu_supports("sse4.2"))
+        return Isa::sse42;
+#endif
+    return Isa::scalar;
+}
+
+/// chosen once at startup; every node search dispatches on it
+inline const Isa node_search_isa = detect_isa();
+
+/// keys a node can search with counting kernels instead of calls to Compare
+template <typename KeyT, typename Compare>
+concept Counting_searchable =
+    std::is_arithmetic_v<KeyT> &&
+    (std::same_as<Compare, std::less<KeyT>> || std::same_as<Compare, std::less<>>);
+
+/// keys with vector kernels: signed 32- and 64-bit integers
+template <typename KeyT>
+concept Vector_searchable =
+    std::is_integral_v<KeyT> && std::is_signed_v<KeyT> && (sizeof(KeyT) == 4 || sizeof(KeyT) == 8);
+
+namespace node_search {
+
+/// number of keys x in [keys, keys + n) with key > x, or with x > key when !KeyGreater
+template <bool KeyGreater, typename KeyT>
+std::size_t count_scalar(const KeyT *keys, std::size_t n, KeyT key) noexcept {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i)
+        count += KeyGreater ? key > keys[i] : keys[i] > key;
+    return count;
+}
+
+#ifdef RB_TREE_X86_KERNELS
+
+// Every kernel compares a whole vector of keys with the bound, turns the lane results into a
+// bit mask with movemask and adds its popcount. A tail shorter than a vector reloads the last
+// full vector of the node and drops the lanes already counted, so no load leaves [keys, keys + n).
+
+/// lane mask of key > x (or x > key) over the four or two keys at at
+template <bool KeyGreater, typename KeyT>
+__attribute__((target("sse4.2,popcnt"))) inline unsigned mask_sse42(const KeyT *at, KeyT key) {
+    const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(at));
+    if constexpr (sizeof(KeyT) == 4) {
+        const auto bound = _mm_set1_epi32(key);
+        return static_cast<unsigned>(_mm_movemask_ps(
+            _mm_castsi128_ps(KeyGreater ? _mm_cmpgt_epi32(bound, v) : _mm_cmpgt_epi32(v, bound))));
+    } else {
+        const auto bound = _mm_set1_epi64x(key);
+        return static_cast<unsigned>(_mm_movemask_pd(
+            _mm_castsi128_pd(KeyGreater ? _mm_cmpgt_epi64(bound, v) : _mm_cmpgt_epi64(v, bound))));
+    }
+}
+
+/// lane mask of key > x (or x > key) over the eight or four keys at at
+template <bool KeyGreater, typename KeyT>
+__attribute__((target("avx2,popcnt"))) inline unsigned mask_avx2(const KeyT *at, KeyT key) {
+    const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(at));
+    if constexpr (sizeof(KeyT) == 4) {
+        const auto bound = _mm256_set1_epi32(key);
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(
+            KeyGreater ? _mm256_cmpgt_epi32(bound, v) : _mm256_cmpgt_epi32(v, bound))));
+    } else {
+        const auto bound = _mm256_set1_epi64x(key);
+        return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(
+            KeyGreater ? _mm256_cmpgt_epi64(bound, v) : _mm256_cmpgt_epi64(v, bound))));
+    }
+}
+
+template <bool KeyGreater, typename KeyT>
+__attribute__((target("sse4.2,popcnt"))) std::size_t count_sse42(const KeyT *keys, std::size_t n,
+                                                                  KeyT key) noexcept {
+    constexpr std::size_t lanes = 16 / sizeof(KeyT);
+    if (n < lanes)
+        return count_scalar<KeyGreater>(keys, n, key);
+
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + lanes <= n; i += lanes)
+        count += std::popcount(mask_sse42<KeyGreater>(keys + i, key));
+    if (i < n)
+        count += std::popcount(mask_sse42<KeyGreater>(keys + n - lanes, key) >> (lanes - (n - i)));
+    return count;
+}
+
+template <bool KeyGreater, typename KeyT>
+__attribute__((target("avx2,popcnt"))) std::size_t count_avx2(const KeyT *keys, std::size_t n,
+                                                               KeyT key) noexcept {
+    constexpr std::size_t lanes = 32 / sizeof(KeyT);
+    if (n < lanes)
+        return count_sse42<KeyGreater>(keys, n, key);
+
+    // two vectors per step: 16 int keys against the bound at once
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + 2 * lanes <= n; i += 2 * lanes)
+        count += std::popcount(mask_avx2<KeyGreater>(keys + i, key)) +
+                 std::popcount(mask_avx2<KeyGreater>(keys + i + lanes, key));
+    for (; i + lanes <= n; i += lanes)
+        count += std::popcount(mask_avx2<KeyGreater>(keys + i, key));
+    if (i < n)
+        count += std::popcount(mask_avx2<KeyGreater>(keys + n - lanes, key) >> (lanes - (n - i)));
+    return count;
+}
+
+#endif // RB_TREE_X86_KERNELS
+
+/// count_scalar, count_sse42 or count_avx2 as isa asks; a level without kernels for KeyT or
+/// this CPU family falls back to the scalar loop
+template <bool KeyGreater, typename KeyT>
+std::size_t count(Isa isa, const KeyT *keys, std::size_t n, KeyT key) noexcept {
+#ifdef RB_TREE_X86_KERNELS
+    if constexpr (Vector_searchable<KeyT>) {
+        switch (isa) {
+        case Isa::avx2:
+            return count_avx2<KeyGreater>(keys, n, key);
+        case Isa::sse42:
+            return count_sse42<KeyGreater>(keys, n, key);
+        case Isa::scalar:
+            break;
+        }
+    }
+#endif
+    (void)isa;
+    return count_scalar<KeyGreater>(keys, n, key);
+}
+
+} // namespace node_search
+
+/// number of keys in the sorted node [keys, keys + n) less than key: a vector count for
+/// arithmetic keys ordered by std::less, a binary search with comp otherwise
+template <typename KeyT, typename Compare>
+std::size_t node_lower_count(const KeyT *keys, std::size_t n, const KeyT &key,
+                             const Compare &comp) {
+    if constexpr (Counting_searchable<KeyT, Compare>)
+        return node_search::count<true>(node_search_isa, keys, n, key);
+    else
+        return static_cast<std::size_t>(std::lower_bound(keys, keys + n, key, comp) - keys);
+}
+
+/// number of keys in the sorted node [keys, keys + n) not greater than key
+template <typename KeyT, typename Compare>
+std::size_t node_upper_count(const KeyT *keys, std::size_t n, const KeyT &key,
+                             const Compare &comp) {
+    if constexpr (Counting_searchable<KeyT, Compare>)
+        return n - node_search::count<false>(node_search_isa, keys, n, key);
+    else
+        return static_cast<std::size_t>(std::upper_bound(keys, keys + n, key, comp) - keys);
+}
+
+} // namespace RB_tree
+
+#endif // INCLUDE_NODE_SEARCH_HPP
@@ -0,0 +1,192 @@
+#ifndef INCLUDE_PARALLEL_SORT_HPP
+#define INCLUDE_PARALLEL_SORT_HPP
+
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace RB_tree {
+
+namespace parallel {
+
+/// below this many keys per thread the pool costs more than it saves
+inline constexpr std::size_t min_keys_per_task = 1 << 12;
+
+/// pieces to cut n keys into for pool: one per thread, fewer when they would be too small
+inline std::size_t pieces(std::size_t n, const Thread_pool &pool) {
+    return std::clamp<std::size_t>(n / min_keys_per_task, 1, pool.size());
+}
+
+/// one slice of a merge: a[a_first, a_last) and b[b_first, b_last) go to out[a_first + b_first)
+struct Merge_task {
+    std::size_t a_first, a_last, b_first, b_last;
+};
+
+/// cuts the merge of a and b into at most count independent slices: pivots evenly spaced in
+/// the longer input, each looked up in the shorter one
+template <typename T, typename Compare>
+void cut_merge(std::span<const T> a, std::span<const T> b, std::size_t count, Compare comp,
+               std::vector<Merge_task> &tasks) {
+    const bool a_longer = a.size() >= b.size();
+    const auto &longer = a_longer ? a : b;
+    const auto &shorter = a_longer ? b : a;
+
+    std::size_t long_first = 0;
+    std::size_t short_first = 0;
+    for (std::size_t i = 1; i <= count; ++i) {
+        std::size_t long_last = longer.size();
+        std::size_t short_last = shorter.size();
+        if (i != count) {
+            long_last = i * longer.size() / count;
+            if (long_last == longer.size())
+                continue;
+            short_last = static_cast<std::size_t>(
+                std::lower_bound(shorter.begin(), shorter.end(), longer[long_last], comp) -
+                shorter.begin());
+        }
+        if (a_longer)
+            tasks.push_back({long_first, long_last, short_first, short_last});
+        else
+            tasks.push_back({short_first, short_last, long_first, long_last});
+        long_first = long_last;
+        short_first = short_last;
+    }
+}
+
+template <typename T, typename Compare>
+void run_merge(std::span<const T> a, std::span<const T> b, std::span<T> out,
+               const Merge_task &task, Compare comp) {
+    std::merge(a.begin() + static_cast<std::ptrdiff_t>(task.a_first),
+               a.begin() + static_cast<std::ptrdiff_t>(task.a_last),
+               b.begin() + static_cast<std::ptrdiff_t>(task.b_first),
+               b.begin() + static_cast<std::ptrdiff_t>(task.b_last),
+               out.begin() + static_cast<std::ptrdiff_t>(task.a_first + task.b_first), comp);
+}
+
+} // namespace parallel
+
+/// merges sorted a and b into out (a.size() + b.size() long) across the pool
+template <typename T, typename Compare>
+void parallel_merge(std::span<const T> a, std::span<const T> b, std::span<T> out, Compare comp,
+                    Thread_pool &pool) {
+    std::vector<parallel::Merge_task> tasks;
+    parallel::cut_merge(a, b, parallel::pieces(a.size() + b.size(), pool), comp, tasks);
+    pool.run_tasks(tasks.size(),
+                   [&](std::size_t i) { parallel::run_merge(a, b, out, tasks[i], comp); });
+}
+
+/// sorts keys across the pool: one std::sort per piece, then rounds that merge neighbouring
+/// runs pairwise, every merge cut into slices so that all threads work in every round
+template <typename T, typename Compare>
+void parallel_sort(std::span<T> keys, Compare comp, Thread_pool &pool) {
+    const auto n = keys.size();
+    const auto count = parallel::pieces(n, pool);
+    if (count == 1) {
+        std::sort(keys.begin(), keys.end(), comp);
+        return;
+    }
+
+    // runs[i] starts at key runs[i]; runs.back() == n
+    std::vector<std::size_t> runs(count + 1);
+    for (std::size_t i = 0; i <= count; ++i)
+        runs[i] = i * n / count;
+    pool.run_tasks(count, [&](std::size_t i) {
+        std::sort(keys.begin() + static_cast<std::ptrdiff_t>(runs[i]),
+                  keys.begin() + static_cast<std::ptrdiff_t>(runs[i + 1]), comp);
+    });
+
+    std::vector<T> buffer(n);
+    std::span<T> from = keys;
+    std::span<T> to = buffer;
+    struct Slice {
+        std::size_t first, middle, last; // merges [first, middle) with [middle, last)
+        parallel::Merge_task task;
+    };
+    std::vector<Slice> slices;
+    std::vector<parallel::Merge_task> cut;
+    while (runs.size() > 2) {
+        slices.clear();
+        std::vector<std::size_t> merged{0};
+        const auto pairs = (runs.size() - 1) / 2;
+        for (std::size_t r = 0; r + 1 < runs.size(); r += 2) {
+            const auto first = runs[r];
+            const auto middle = runs[r + 1];
+            const auto last = r + 2 < runs.size() ? runs[r + 2] : middle;
+            cut.clear();
+            parallel::cut_merge(std::span<const T>(from.subspan(first, middle - first)),
+                                std::span<const T>(from.subspan(middle, last - middle)),
+                                std::max<std::size_t>(1, count / pairs), comp, cut);
+            for (const auto &task : cut)
+                slices.push_back({first, middle, last, task});
+            merged.push_back(last);
+        }
+        pool.run_tasks(slices.size(), [&](std::size_t i) {
+            const auto &s = slices[i];
+            parallel::run_merge(std::span<const T>(from.subspan(s.first, s.middle - s.first)),
+                                std::span<const T>(from.subspan(s.middle, s.last - s.middle)),
+                                to.subspan(s.first, s.last - s.first), s.task, comp);
+        });
+        runs = std::move(merged);
+        std::swap(from, to);
+    }
+
+    if (from.data() != keys.data())
+        pool.run_tasks(count, [&](std::size_t i) {
+            std::copy(from.begin() + static_cast<std::ptrdiff_t>(i * n / count),
+                      from.begin() + static_cast<std::ptrdiff_t>((i + 1) * n / count),
+                      keys.begin() + static_cast<std::ptrdiff_t>(i * n / count));
+        });
+}
+
+/// true when [first, last) is sorted without repeated keys; checked across the pool
+template <std::random_access_iterator It, typename Compare>
+bool parallel_is_strictly_sorted(It first, It last, Compare comp, Thread_pool &pool) {
+    const auto n = static_cast<std::size_t>(last - first);
+    const auto count = parallel::pieces(n, pool);
+    std::vector<char> sorted(count);
+    pool.run_tasks(count, [&](std::size_t i) {
+        // each piece also compares its first key with the key before it
+        const auto begin = first + static_cast<std::ptrdiff_t>(i * n / count);
+        const auto end = first + static_cast<std::ptrdiff_t>((i + 1) * n / count);
+        sorted[i] = std::adjacent_find(begin == first ? begin : begin - 1, end,
+                                       [&](const auto &a, const auto &b) {
+                                           return !comp(a, b);
+                                       }) == end;
+    });
+    return std::all_of(sorted.begin(), sorted.end(), [](char s) { return s != 0; });
+}
+
+/// the keys of sorted [first, last) without repeats: every piece counts the keys that differ
+/// from their predecessor, and a prefix sum of the counts tells it where to copy them
+template <std::random_access_iterator It, typename Compare>
+std::vector<std::iter_value_t<It>> parallel_unique(It first, It last, Compare comp,
+                                                   Thread_pool &pool) {
+    const auto n = static_cast<std::size_t>(last - first);
+    const auto count = parallel::pieces(n, pool);
+    auto is_new = [&](std::size_t i) { return i == 0 || comp(first[i - 1], first[i]); };
+
+    std::vector<std::size_t> offsets(count + 1, 0);
+    pool.run_tasks(count, [&](std::size_t i) {
+        for (auto k = i * n / count; k != (i + 1) * n / count; ++k)
+            offsets[i + 1] += is_new(k);
+    });
+    for (std::size_t i = 0; i < count; ++i)
+        offsets[i + 1] += offsets[i];
+
+    std::vector<std::iter_value_t<It>> keys(offsets.back());
+    pool.run_tasks(count, [&](std::size_t i) {
+        auto out = offsets[i];
+        for (auto k = i * n / count; k != (i + 1) * n / count; ++k)
+            if (is_new(k))
+                keys[out++] = first[k];
+    });
+    return keys;
+}
+
+} // namespace RB_tree
+
+#endif // INCLUDE_PARALLEL_SORT_HPP
@@ -0,0 +1,464 @@
+#ifndef INCLUDE_PERSISTENT_NODE_HPP
+#define INCLUDE_PERSISTENT_NODE_HPP
+
+#include "node.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace RB_tree {
+
+/// immutable red-black node: once linked into a published root it is never written again, so
+/// several roots can share it and readers need no synchronization to walk it
+template <typename KeyT> class Persistent_node final {
+  private:
+    const Persistent_node *left_;
+    const Persistent_node *right_;
+    std::size_t size_;
+    KeyT key_;
+    Color color_;
+
+  public:
+    Persistent_node(const KeyT &key, const Persistent_node *left, const Persistent_node *right,
+                    Color color)
+        : left_(left), right_(right), size_(1 + size_of(left) + size_of(right)), key_(key),
+          color_(color) {}
+
+    Persistent_node(const Persistent_node &) = delete;
+    Persistent_node &operator=(const Persistent_node &) = delete;
+
+    [[nodiscard]] bool is_red() const noexcept { return color_ == Color::red; }
+    [[nodiscard]] Color get_color() const noexcept { return color_; }
+    [[nodiscard]] const Persistent_node *get_left() const noexcept { return left_; }
+    [[nodiscard]] const Persistent_node *get_right() const noexcept { return right_; }
+    [[nodiscard]] const KeyT &get_key() const noexcept { return key_; }
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    static std::size_t size_of(const Persistent_node *n) noexcept { return n ? n->size_ : 0; }
+    static bool is_red(const Persistent_node *n) noexcept { return n && n->is_red(); }
+};
+
+/// number of keys of the subtree at n that are less than key
+template <typename KeyT, typename Compare>
+std::size_t persistent_rank(const Persistent_node<KeyT> *n, const KeyT &key, const Compare &comp) {
+    std::size_t rank = 0;
+    while (n) {
+        if (comp(n->get_key(), key)) {
+            rank += Persistent_node<KeyT>::size_of(n->get_left()) + 1;
+            n = n->get_right();
+        } else {
+            n = n->get_left();
+        }
+    }
+    return rank;
+}
+
+/// number of keys of the subtree at n that are not greater than key
+template <typename KeyT, typename Compare>
+std::size_t persistent_upper_rank(const Persistent_node<KeyT> *n, const KeyT &key,
+                                  const Compare &comp) {
+    std::size_t rank = 0;
+    while (n) {
+        if (comp(key, n->get_key())) {
+            n = n->get_left();
+        } else {
+            rank += Persistent_node<KeyT>::size_of(n->get_left()) + 1;
+            n = n->get_right();
+        }
+    }
+    return rank;
+}
+
+/// first key not less than key, nullptr when there is none
+template <typename KeyT, typename Compare>
+const KeyT *persistent_lower_bound(const Persistent_node<KeyT> *n, const KeyT &key,
+                                   const Compare &comp) {
+    const KeyT *result = nullptr;
+    while (n) {
+        if (comp(n->get_key(), key)) {
+            n = n->get_right();
+        } else {
+            result = &n->get_key();
+            n = n->get_left();
+        }
+    }
+    return result;
+}
+
+/// first key greater than key, nullptr when there is none
+template <typename KeyT, typename Compare>
+const KeyT *persistent_upper_bound(const Persistent_node<KeyT> *n, const KeyT &key,
+                                   const Compare &comp) {
+    const KeyT *result = nullptr;
+    while (n) {
+        if (comp(key, n->get_key())) {
+            result = &n->get_key();
+            n = n->get_left();
+        } else {
+            n = n->get_right();
+        }
+    }
+    return result;
+}
+
+/// k-th smallest key counting from 0, nullptr when k is out of range
+template <typename KeyT>
+const KeyT *persistent_select(const Persistent_node<KeyT> *n, std::size_t k) {
+    while (n) {
+        const auto left = Persistent_node<KeyT>::size_of(n->get_left());
+        if (k < left) {
+            n = n->get_left();
+        } else if (k == left) {
+            return &n->get_key();
+        } else {
+            k -= left + 1;
+            n = n->get_right();
+        }
+    }
+    return nullptr;
+}
+
+/// black height of a valid subtree, -1 on a red-red edge, a black-height or size mismatch or
+/// keys out of order
+template <typename KeyT, typename Compare>
+int persistent_check(const Persistent_node<KeyT> *n, const Compare &comp,
+                     const KeyT *lo = nullptr, const KeyT *hi = nullptr) {
+    if (!n)
+        return 1;
+    if ((lo && !comp(*lo, n->get_key())) || (hi && !comp(n->get_key(), *hi)))
+        return -1;
+    if (n->is_red() && (Persistent_node<KeyT>::is_red(n->get_left()) ||
+                        Persistent_node<KeyT>::is_red(n->get_right())))
+        return -1;
+    if (n->size() != 1 + Persistent_node<KeyT>::size_of(n->get_left()) +
+                         Persistent_node<KeyT>::size_of(n->get_right()))
+        return -1;
+
+    const int left = persistent_check(n->get_left(), comp, lo, &n->get_key());
+    const int right = persistent_check(n->get_right(), comp, &n->get_key(), hi);
+    if (left < 0 || left != right)
+        return -1;
+    return left + (n->is_red() ? 0 : 1);
+}
+
+/// functional red-black insertion (Okasaki's balance) that copies the search path and leaves the
+/// old root intact; only the thread that owns the copier may call it
+template <typename KeyT, typename Compare, typename Allocator> class Path_copier final {
+  public:
+    using node_type = Persistent_node<KeyT>;
+    using allocator_type =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+
+  private:
+    using node_traits = std::allocator_traits<allocator_type>;
+
+    [[no_unique_address]] allocator_type alloc_;
+    [[no_unique_address]] Compare comp_;
+    std::size_t live_nodes_ = 0;
+
+    // erase rebuilds through intermediate nodes it drops again; they are collected here and
+    // freed once the new root is known
+    std::vector<const node_type *> fresh_;
+    bool tracking_ = false;
+
+  public:
+    explicit Path_copier(const Allocator &alloc = Allocator(), const Compare &comp = Compare())
+        : alloc_(alloc), comp_(comp) {}
+
+    /// root of the tree with key added, or root itself when key is already there; nodes of the
+    /// old version that the new one no longer uses are appended to replaced
+    const node_type *insert(const node_type *root, const KeyT &key,
+                            std::vector<const node_type *> &replaced) {
+        bool inserted = false;
+        const auto *result = insert_into(root, key, inserted, replaced);
+        if (!inserted || !result->is_red())
+            return result;
+
+        // the root is always a fresh node here, so it can be swapped for a black copy in place
+        const auto *black = create_node(result->get_key(), result->get_left(),
+                                        result->get_right(), Color::black);
+        destroy_node(result);
+        return black;
+    }
+
+    /// root of the tree without key, or root itself when key is not there. The copied nodes of
+    /// the new version are fresh and the old version is left intact, so the caller decides when
+    /// its nodes go away
+    const node_type *erase(const node_type *root, const KeyT &key) {
+        const KeyT *found = persistent_lower_bound(root, key, comp_);
+        if (!found || comp_(key, *found))
+            return root;
+
+        fresh_.clear();
+        tracking_ = true;
+        const auto *result = erase_from(root, key);
+        if (node_type::is_red(result))
+            result = node(Color::black, result->get_left(), result->get_key(), result->get_right());
+        tracking_ = false;
+        release_unreachable(result);
+        return result;
+    }
+
+    /// nodes created and not yet destroyed by this copier
+    [[nodiscard]] std::size_t live_nodes() const noexcept { return live_nodes_; }
+
+    const allocator_type &get_allocator() const noexcept { return alloc_; }
+
+    /// destroys every node of the subtree at n; only for nodes no other root shares
+    void destroy_subtree(const node_type *n) noexcept {
+        while (n) {
+            destroy_subtree(n->get_right());
+            const auto *left = n->get_left();
+            destroy_node(n);
+            n = left;
+        }
+    }
+
+    void destroy_node(const node_type *n) noexcept {
+        auto *node = const_cast<node_type *>(n);
+        node_traits::destroy(alloc_, node);
+        node_traits::deallocate(alloc_, node, 1);
+        --live_nodes_;
+    }
+
+  private:
+    const node_type *insert_into(const node_type *n, const KeyT &key, bool &inserted,
+                                 std::vector<const node_type *> &replaced) {
+        if (!n) {
+            inserted = true;
+            return create_node(key, nullptr, nullptr, Color::red);
+        }
+
+        if (comp_(key, n->get_key())) {
+            const auto *left = insert_into(n->get_left(), key, inserted, replaced);
+            if (!inserted)
+                return n;
+            replaced.push_back(n);
+            return balance(n->get_color(), left, n->get_key(), n->get_right());
+        }
+        if (comp_(n->get_key(), key)) {
+            const auto *right = insert_into(n->get_right(), key, inserted, replaced);
+            if (!inserted)
+                return n;
+            replaced.push_back(n);
+            return balance(n->get_color(), n->get_left(), n->get_key(), right);
+        }
+        return n;
+    }
+
+    /// Okasaki's four red-red cases; the red pair always lies on the copied path, so both of its
+    /// nodes are fresh and can be freed right away
+    const node_type *balance(Color color, const node_type *left, const KeyT &key,
+                             const node_type *right) {
+        if (color == Color::black) {
+            if (node_type::is_red(left)) {
+                if (node_type::is_red(left->get_left())) {
+                    const auto *ll = left->get_left();
+                    return rebuild(ll->get_left(), ll->get_key(), ll->get_right(), left->get_key(),
+                                   left->get_right(), key, right, left, ll);
+                }
+                if (node_type::is_red(left->get_right())) {
+                    const auto *lr = left->get_right();
+                    return rebuild(left->get_left(), left->get_key(), lr->get_left(),
+                                   lr->get_key(), lr->get_right(), key, right, left, lr);
+                }
+            }
+            if (node_type::is_red(right)) {
+                if (node_type::is_red(right->get_left())) {
+                    const auto *rl = right->get_left();
+                    return rebuild(left, key, rl->get_left(), rl->get_key(), rl->get_right(),
+                                   right->get_key(), right->get_right(), right, rl);
+                }
+                if (node_type::is_red(right->get_right())) {
+                    const auto *rr = right->get_right();
+                    return rebuild(left, key, right->get_left(), right->get_key(),
+                                   rr->get_left(), rr->get_key(), rr->get_right(), right, rr);
+                }
+            }
+        }
+        return create_node(key, left, right, color);
+    }
+
+    /// red y over black x and z: (a x b) y (c z d)
+    const node_type *rebuild(const node_type *a, const KeyT &x, const node_type *b, const KeyT &y,
+                             const node_type *c, const KeyT &z, const node_type *d,
+                             const node_type *fresh_parent, const node_type *fresh_child) {
+        const auto *result = create_node(y, create_node(x, a, b, Color::black),
+                                         create_node(z, c, d, Color::black), Color::red);
+        destroy_node(fresh_child);
+        destroy_node(fresh_parent);
+        return result;
+    }
+
+    const node_type *create_node(const KeyT &key, const node_type *left, const node_type *right,
+                                 Color color) {
+        auto *node = node_traits::allocate(alloc_, 1);
+        node_traits::construct(alloc_, node, key, left, right, color);
+        ++live_nodes_;
+        if (tracking_)
+            fresh_.push_back(node);
+        return node;
+    }
+
+    // Functional deletion after Kahrs ("Red-black trees with types"): erase_from returns a
+    // subtree whose black height is one less when it removed a black node, and balance_left /
+    // balance_right repair the deficit on the way up with recolored copies.
+
+    const node_type *node(Color color, const node_type *left, const KeyT &key,
+                          const node_type *right) {
+        return create_node(key, left, right, color);
+    }
+
+    static bool is_black(const node_type *n) noexcept { return n && !n->is_red(); }
+
+    const node_type *erase_from(const node_type *n, const KeyT &key) {
+        if (comp_(key, n->get_key())) {
+            if (is_black(n->get_left()))
+                return balance_left(erase_from(n->get_left(), key), n->get_key(), n->get_right());
+            return node(Color::red, erase_from(n->get_left(), key), n->get_key(), n->get_right());
+        }
+        if (comp_(n->get_key(), key)) {
+            if (is_black(n->get_right()))
+                return balance_right(n->get_left(), n->get_key(), erase_from(n->get_right(), key));
+            return node(Color::red, n->get_left(), n->get_key(), erase_from(n->get_right(), key));
+        }
+        return join(n->get_left(), n->get_right());
+    }
+
+    /// the left subtree lost a black level
+    const node_type *balance_left(const node_type *left, const KeyT &key, const node_type *right) {
+        if (node_type::is_red(left))
+            return node(Color::red, recolor(left, Color::black), key, right);
+        if (is_black(right))
+            return rebalance(left, key, recolor(right, Color::red));
+        assert(node_type::is_red(right) && is_black(right->get_left()));
+        const auto *rl = right->get_left();
+        return node(Color::red, node(Color::black, left, key, rl->get_left()), rl->get_key(),
+                    rebalance(rl->get_right(), right->get_key(),
+                              recolor(right->get_right(), Color::red)));
+    }
+
+    /// the right subtree lost a black level
+    const node_type *balance_right(const node_type *left, const KeyT &key, const node_type *right) {
+        if (node_type::is_red(right))
+            return node(Color::red, left, key, recolor(right, Color::black));
+        if (is_black(left))
+            return rebalance(recolor(left, Color::red), key, right);
+        assert(node_type::is_red(left) && is_black(left->get_right()));
+        const auto *lr = left->get_right();
+        return node(Color::red,
+                    rebalance(recolor(left->get_left(), Color::red), left->get_key(),
+                              lr->get_left()),
+                    lr->get_key(), node(Color::black, lr->get_right(), key, right));
+    }
+
+    /// black node over left and right, or a red node over two black ones when one side holds a
+    /// red-red pair
+    const node_type *rebalance(const node_type *left, const KeyT &key, const node_type *right) {
+        using N = node_type;
+        constexpr auto red = Color::red;
+        constexpr auto black = Color::black;
+        if (N::is_red(left) && N::is_red(right))
+            return node(red, recolor(left, black), key, recolor(right, black));
+        if (N::is_red(left) && N::is_red(left->get_left()))
+            return node(red, recolor(left->get_left(), black), left->get_key(),
+                        node(black, left->get_right(), key, right));
+        if (N::is_red(left) && N::is_red(left->get_right())) {
+            const auto *lr = left->get_right();
+            return node(red, node(black, left->get_left(), left->get_key(), lr->get_left()),
+                        lr->get_key(), node(black, lr->get_right(), key, right));
+        }
+        if (N::is_red(right) && N::is_red(right->get_right()))
+            return node(red, node(black, left, key, right->get_left()), right->get_key(),
+                        recolor(right->get_right(), black));
+        if (N::is_red(right) && N::is_red(right->get_left())) {
+            const auto *rl = right->get_left();
+            return node(red, node(black, left, key, rl->get_left()), rl->get_key(),
+                        node(black, rl->get_right(), right->get_key(), right->get_right()));
+        }
+        return node(black, left, key, right);
+    }
+
+    /// every key of left is less than every key of right, both have the same black height
+    const node_type *join(const node_type *left, const node_type *right) {
+        if (!left)
+            return right;
+        if (!right)
+            return left;
+
+        if (left->is_red() && right->is_red()) {
+            const auto *middle = join(left->get_right(), right->get_left());
+            if (node_type::is_red(middle))
+                return node(Color::red,
+                            node(Color::red, left->get_left(), left->get_key(), middle->get_left()),
+                            middle->get_key(),
+                            node(Color::red, middle->get_right(), right->get_key(),
+                                 right->get_right()));
+            return node(Color::red, left->get_left(), left->get_key(),
+                        node(Color::red, middle, right->get_key(), right->get_right()));
+        }
+        if (!left->is_red() && !right->is_red()) {
+            const auto *middle = join(left->get_right(), right->get_left());
+            if (node_type::is_red(middle))
+                return node(Color::red,
+                            node(Color::black, left->get_left(), left->get_key(),
+                                 middle->get_left()),
+                            middle->get_key(),
+                            node(Color::black, middle->get_right(), right->get_key(),
+                                 right->get_right()));
+            return balance_left(left->get_left(), left->get_key(),
+                                node(Color::black, middle, right->get_key(), right->get_right()));
+        }
+        if (right->is_red())
+            return node(Color::red, join(left, right->get_left()), right->get_key(),
+                        right->get_right());
+        return node(Color::red, left->get_left(), left->get_key(), join(left->get_right(), right));
+    }
+
+    /// copy of n with another color; n may be nullptr only when color is black
+    const node_type *recolor(const node_type *n, Color color) {
+        if (!n) {
+            assert(color == Color::black);
+            return n;
+        }
+        if (n->get_color() == color)
+            return n;
+        return node(color, n->get_left(), n->get_key(), n->get_right());
+    }
+
+    /// frees the nodes erase created that the new root does not reach
+    void release_unreachable(const node_type *root) {
+        std::sort(fresh_.begin(), fresh_.end());
+        std::vector<bool> reached(fresh_.size());
+        auto index_of = [&](const node_type *n) -> std::size_t {
+            auto it = std::lower_bound(fresh_.begin(), fresh_.end(), n);
+            return it != fresh_.end() && *it == n ? static_cast<std::size_t>(it - fresh_.begin())
+                                                  : fresh_.size();
+        };
+
+        // old nodes never point at fresh ones, so the walk stops at the first old node
+        std::vector<const node_type *> stack{root};
+        while (!stack.empty()) {
+            const auto *n = stack.back();
+            stack.pop_back();
+            const auto i = index_of(n);
+            if (!n || i == fresh_.size() || reached[i])
+                continue;
+            reached[i] = true;
+            stack.push_back(n->get_left());
+            stack.push_back(n->get_right());
+        }
+
+        for (std::size_t i = 0; i < fresh_.size(); ++i)
+            if (!reached[i])
+                destroy_node(fresh_[i]);
+        fresh_.clear();
+    }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_PERSISTENT_NODE_HPP
@@ -1,8 +1,12 @@
 #ifndef INCLUDE_RANGE_QUERY_HPP
 #define INCLUDE_RANGE_QUERY_HPP
 
+#include "thread_pool.hpp"
+#include <cstddef>
 #include <cstdlib>
 #include <iterator>
+#include <span>
+#include <utility>
 
 namespace RB_tree {
 
@@ -11,15 +15,81 @@ auto range_query(const C &s, const KeyT &fst, const KeyT &snd) {
     if (!s.key_comp()(fst, snd))
         return 0l;
 
-    auto start = s.lower_bound(fst);
+#ifndef RB_TREE_LOG_RUN
+    // containers without iterators (a frozen index) only have count_in_range
+    if constexpr (requires { s.bounds(fst, snd); }) {
+        auto [start, fin] = s.bounds(fst, snd);
 
-    auto fin = s.upper_bound(snd);
+        return std::distance(start, fin);
+    } else if constexpr (requires { s.lower_bound(fst); }) {
+        auto start = s.lower_bound(fst);
 
-#ifndef RB_TREE_LOG_RUN
-    return std::distance(start, fin);
+        auto fin = s.upper_bound(snd);
+
+        return std::distance(start, fin);
+    } else {
+        return static_cast<long>(s.count_in_range(fst, snd));
+    }
 #else
-    return s.log_distance(start, fin);
+    return static_cast<long>(s.count_in_range(fst, snd));
+#endif
+}
+
+/// range_query on a past version of s, a container that keeps its versions
+template <typename C, typename KeyT>
+long range_query(const C &s, std::size_t version, const KeyT &fst, const KeyT &snd) {
+    if (!s.key_comp()(fst, snd))
+        return 0;
+    return static_cast<long>(s.count_in_range(version, fst, snd));
+}
+
+/// out[i] = range_query(s, queries[i].first, queries[i].second); counting containers with a
+/// batched descent (Tree::count_in_range_batch) answer a group of queries in lockstep
+template <typename C, typename KeyT, typename Count>
+void range_query_batch(const C &s, std::span<const std::pair<KeyT, KeyT>> queries,
+                       std::span<Count> out) {
+#ifdef RB_TREE_LOG_RUN
+    if constexpr (requires { s.count_in_range_batch(queries, out); }) {
+        s.count_in_range_batch(queries, out);
+        // range_query answers 0 for an empty or one-key interval
+        for (std::size_t i = 0; i != queries.size(); ++i)
+            if (!s.key_comp()(queries[i].first, queries[i].second))
+                out[i] = 0;
+        return;
+    }
 #endif
+    for (std::size_t i = 0; i != queries.size(); ++i)
+        out[i] = static_cast<Count>(range_query(s, queries[i].first, queries[i].second));
+}
+
+/// answers every query of a run into results[i], split across the pool; s must not change meanwhile
+template <typename C, typename KeyT>
+void range_query_run(const C &s, std::span<const std::pair<KeyT, KeyT>> queries,
+                     std::span<long> results, Thread_pool &pool) {
+    pool.parallel_for(queries.size(), [&](std::size_t begin, std::size_t end) {
+        range_query_batch(s, queries.subspan(begin, end - begin),
+                          results.subspan(begin, end - begin));
+    });
+}
+
+/// k-th smallest key of s counting from 0, s.end() when k is out of range
+template <typename C> auto select_query(const C &s, std::size_t k) {
+    if constexpr (requires { s.select(k); })
+        return s.select(k);
+    else
+        return k < s.size() ? std::next(s.begin(), static_cast<std::ptrdiff_t>(k)) : s.end();
+}
+
+/// index of the nearest-rank percentile (0 <= percent <= 100) among n > 0 keys
+inline std::size_t percentile_index(std::size_t n, int percent) {
+    const auto rank = (static_cast<std::size_t>(percent) * n + 99) / 100;
+    return rank == 0 ? 0 : rank - 1;
+}
+
+/// first and last key of s between the lo-th and hi-th percentiles
+template <typename C> auto percentile_range(const C &s, int lo, int hi) {
+    return std::pair{select_query(s, percentile_index(s.size(), lo)),
+                     select_query(s, percentile_index(s.size(), hi))};
 }
 
 } // namespace RB_tree
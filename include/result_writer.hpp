@@ -0,0 +1,103 @@
+#ifndef INCLUDE_RESULT_WRITER_HPP
+#define INCLUDE_RESULT_WRITER_HPP
+
+#include <bit>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <unistd.h>
+#include <vector>
+
+namespace RB_tree {
+
+/// output sink of driver(): formats values into one reusable buffer and hands it to write(2) in
+/// large pieces; in binary mode every value is a little-endian 64-bit signed integer
+class Result_writer final {
+  public:
+    enum class Mode : bool { text, binary };
+
+  private:
+    static constexpr std::size_t buffer_size = 1 << 16;
+    static constexpr std::size_t max_value_size = 24; // "-9223372036854775808 " fits
+
+    int fd_;
+    Mode mode_;
+    std::vector<char> buffer_;
+    std::size_t used_ = 0;
+    bool failed_ = false;
+
+  public:
+    explicit Result_writer(int fd = STDOUT_FILENO, Mode mode = Mode::text)
+        : fd_(fd), mode_(mode), buffer_(buffer_size) {}
+
+    Result_writer(const Result_writer &) = delete;
+    Result_writer &operator=(const Result_writer &) = delete;
+
+    ~Result_writer() { flush(); }
+
+    Mode mode() const noexcept { return mode_; }
+
+    /// false once a write(2) has failed; later output is dropped
+    bool good() const noexcept { return !failed_; }
+
+    /// one value, followed by a space in text mode
+    void put(std::int64_t value) {
+        if (buffer_.size() - used_ < max_value_size)
+            flush();
+
+        char *out = buffer_.data() + used_;
+        if (mode_ == Mode::binary) {
+            auto bits = static_cast<std::uint64_t>(value);
+            if constexpr (std::endian::native == std::endian::big)
+                bits = byteswap(bits);
+            std::memcpy(out, &bits, sizeof(bits));
+            used_ += sizeof(bits);
+            return;
+        }
+
+        auto *end = std::to_chars(out, out + max_value_size, value).ptr;
+        *end++ = ' ';
+        used_ = static_cast<std::size_t>(end - buffer_.data());
+    }
+
+    template <typename T> void put(std::span<const T> values) {
+        for (const auto &value : values)
+            put(static_cast<std::int64_t>(value));
+    }
+
+    /// closes the text stream with a line break; binary output gets no terminator
+    void finish() {
+        if (mode_ == Mode::text) {
+            if (used_ == buffer_.size())
+                flush();
+            buffer_[used_++] = '\n';
+        }
+        flush();
+    }
+
+    void flush() {
+        for (std::size_t done = 0; done < used_ && !failed_;) {
+            const auto n = write(fd_, buffer_.data() + done, used_ - done);
+            if (n > 0)
+                done += static_cast<std::size_t>(n);
+            else if (n == 0 || errno != EINTR)
+                failed_ = true;
+        }
+        used_ = 0;
+    }
+
+  private:
+    static std::uint64_t byteswap(std::uint64_t bits) noexcept {
+        std::uint64_t swapped = 0;
+        for (int i = 0; i < 8; ++i, bits >>= 8)
+            swapped = (swapped << 8) | (bits & 0xFF);
+        return swapped;
+    }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_RESULT_WRITER_HPP
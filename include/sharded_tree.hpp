@@ -0,0 +1,382 @@
+#ifndef INCLUDE_SHARDED_TREE_HPP
+#define INCLUDE_SHARDED_TREE_HPP
+
+#include "spsc_queue.hpp"
+#include "tree.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace RB_tree {
+
+/// set partitioned by key range into shards, each a Tree with an arena of its own. With more
+/// than one shard every shard also has a worker thread: insert_batch routes the keys through a
+/// per-shard SPSC queue, each worker inserts its share as one Tree::insert_batch once the batch
+/// is sealed, and the call returns when all shards are done. Between calls the shards are
+/// quiet, so the const members may run on many threads at once. The boundaries come from a
+/// sample of the first batch and are redrawn at the exact quantiles whenever one shard outgrows
+/// the rest by half
+template <typename KeyT, typename Compare = std::less<KeyT>> class Sharded_tree final {
+  public:
+    using tree_type = Tree<KeyT, Compare>;
+    using size_type = std::size_t;
+
+  private:
+    static constexpr size_type queue_capacity = 1 << 14;
+    static constexpr size_type pop_size = 1 << 12;        // keys a worker takes off at once
+    static constexpr size_type max_pending = 1 << 20;     // keys a worker holds back at most
+    static constexpr size_type stage_size = 64;           // keys routed to a queue in one push
+    static constexpr size_type min_routed_batch = 1024;   // smaller batches skip the workers
+    static constexpr size_type sample_per_shard = 1024;   // sampled keys per shard
+    static constexpr size_type min_rebalance_keys = 1024; // per shard
+
+    struct Shard {
+        tree_type tree;
+        Spsc_queue<KeyT> queue{queue_capacity};
+        std::atomic<size_type> done{0};     // keys the worker has inserted
+        std::atomic<size_type> sealed{0};   // pushed, as of the end of the last batch
+        std::atomic<std::uint32_t> wake{0}; // bumped after every push, seal and at shutdown
+        size_type pushed = 0;               // producer side: keys put on the queue
+        size_type inserted = 0;             // worker side: keys that were new, read once done
+        std::jthread worker;                // last, so it is joined before the rest goes
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::vector<KeyT> bounds_;      // shard i holds the keys of [bounds_[i - 1], bounds_[i])
+    std::vector<size_type> before_; // before_[i] keys live in shards 0 .. i - 1
+    std::atomic<bool> stop_{false};
+    Compare comp_;
+
+  public:
+    explicit Sharded_tree(size_type shards = 1, const Compare &comp = Compare())
+        : before_(std::max<size_type>(shards, 1) + 1, 0), comp_(comp) {
+        shards = std::max<size_type>(shards, 1);
+        shards_.reserve(shards);
+        for (size_type i = 0; i < shards; ++i)
+            shards_.push_back(std::make_unique<Shard>());
+        if (shards > 1)
+            for (auto &shard : shards_)
+                shard->worker = std::jthread([this, s = shard.get()] { work(*s); });
+    }
+
+    Sharded_tree(const Sharded_tree &) = delete;
+    Sharded_tree &operator=(const Sharded_tree &) = delete;
+
+    ~Sharded_tree() {
+        stop_.store(true, std::memory_order_release);
+        for (auto &shard : shards_) {
+            shard->wake.fetch_add(1, std::memory_order_release);
+            shard->wake.notify_one();
+        }
+        shards_.clear();
+    }
+
+    Compare key_comp() const { return comp_; }
+
+    size_type size() const noexcept { return before_.back(); }
+    bool empty() const noexcept { return size() == 0; }
+
+    size_type shard_count() const noexcept { return shards_.size(); }
+    size_type shard_size(size_type i) const noexcept { return shards_[i]->tree.size(); }
+    std::span<const KeyT> bounds() const noexcept { return bounds_; }
+
+    bool insert(const KeyT &key) {
+        const auto s = shard_of(key);
+        const bool inserted = shards_[s]->tree.insert(key);
+        if (inserted)
+            for (auto i = s + 1; i < before_.size(); ++i)
+                ++before_[i];
+        return inserted;
+    }
+
+    size_type erase(const KeyT &key) {
+        const auto s = shard_of(key);
+        const auto erased = shards_[s]->tree.erase(key);
+        if (erased)
+            for (auto i = s + 1; i < before_.size(); ++i)
+                --before_[i];
+        return erased;
+    }
+
+    /// inserts keys in any order, each shard's share on its own worker; returns how many were new
+    size_type insert_batch(std::span<const KeyT> keys) {
+        if (keys.empty())
+            return 0;
+        if (shards_.size() > 1 && bounds_.empty() && empty())
+            sample_bounds(keys);
+
+        size_type inserted = 0;
+        if (shards_.size() == 1)
+            inserted = shards_[0]->tree.insert_batch(keys);
+        else if (keys.size() < min_routed_batch)
+            // waking the workers costs more than these inserts
+            for (const auto &key : keys)
+                inserted += shards_[shard_of(key)]->tree.insert(key);
+        else
+            inserted = route(keys);
+
+        recount();
+        if (unbalanced())
+            rebalance();
+        return inserted;
+    }
+
+    /// number of keys less than key
+    size_type rank(const KeyT &key) const {
+        const auto s = shard_of(key);
+        return before_[s] + shards_[s]->tree.rank(key);
+    }
+
+    /// keys in [lo, hi]: the tail of lo's shard, the precounted shards in between and the head
+    /// of hi's shard, so two partial shard queries whatever the range spans. [lo, hi] covers
+    /// everything above lo in lo's shard and everything below hi in hi's, so both partial
+    /// queries are the query itself
+    size_type count_in_range(const KeyT &lo, const KeyT &hi) const {
+        if (comp_(hi, lo))
+            return 0;
+        const auto first = shard_of(lo);
+        const auto last = shard_of(hi);
+        const auto count = shards_[first]->tree.count_in_range(lo, hi);
+        if (first == last)
+            return count;
+        return count + (before_[last] - before_[first + 1]) +
+               shards_[last]->tree.count_in_range(lo, hi);
+    }
+
+    /// out[i] = count_in_range(queries[i].first, queries[i].second); the partial queries are
+    /// grouped by shard and each group answered with Tree::count_in_range_batch
+    template <typename Count>
+    void count_in_range_batch(std::span<const std::pair<KeyT, KeyT>> queries,
+                              std::span<Count> out) const {
+        const auto p = shards_.size();
+        if (p == 1)
+            return shards_[0]->tree.count_in_range_batch(queries, out);
+
+        // counting sort of the partial queries by shard: starts[s] is where shard s's begin
+        std::vector<size_type> starts(p + 1, 0);
+        std::vector<std::pair<size_type, size_type>> ends(queries.size());
+        for (size_type i = 0; i < queries.size(); ++i) {
+            const auto &[lo, hi] = queries[i];
+            ends[i] = comp_(hi, lo) ? std::pair{p, p} : std::pair{shard_of(lo), shard_of(hi)};
+            if (ends[i].first == p)
+                continue;
+            ++starts[ends[i].first + 1];
+            if (ends[i].second != ends[i].first)
+                ++starts[ends[i].second + 1];
+        }
+        for (size_type s = 0; s < p; ++s)
+            starts[s + 1] += starts[s];
+
+        std::vector<std::pair<KeyT, KeyT>> partial(starts[p]);
+        std::vector<size_type> owner(starts[p]);
+        auto next = starts;
+        for (size_type i = 0; i < queries.size(); ++i) {
+            const auto [first, last] = ends[i];
+            out[i] = 0;
+            if (first == p)
+                continue;
+            partial[next[first]] = queries[i];
+            owner[next[first]++] = i;
+            if (last != first) {
+                partial[next[last]] = queries[i];
+                owner[next[last]++] = i;
+                out[i] = static_cast<Count>(before_[last] - before_[first + 1]);
+            }
+        }
+
+        std::vector<Count> counts(partial.size());
+        for (size_type s = 0; s < p; ++s)
+            shards_[s]->tree.count_in_range_batch(
+                std::span<const std::pair<KeyT, KeyT>>(partial).subspan(starts[s],
+                                                                        starts[s + 1] - starts[s]),
+                std::span<Count>(counts).subspan(starts[s], starts[s + 1] - starts[s]));
+        for (size_type j = 0; j < partial.size(); ++j)
+            out[owner[j]] += counts[j];
+    }
+
+    /// k-th smallest key counting from 0, nullptr when k >= size()
+    const KeyT *select(size_type k) const {
+        if (k >= size())
+            return nullptr;
+        const auto s = static_cast<size_type>(
+            std::upper_bound(before_.begin() + 1, before_.end(), k) - before_.begin() - 1);
+        return &*shards_[s]->tree.select(k - before_[s]);
+    }
+
+    /// every shard is a valid tree whose keys lie inside its bounds, and the counts add up
+    [[nodiscard]] bool check_invariants() const {
+        size_type total = 0;
+        for (size_type i = 0; i < shards_.size(); ++i) {
+            const auto &tree = shards_[i]->tree;
+            if (!tree.check_invariants() || before_[i] != total)
+                return false;
+            total += tree.size();
+            if (tree.empty())
+                continue;
+            if (i != 0 && comp_(*tree.select(0), bounds_[i - 1]))
+                return false;
+            if (i < bounds_.size() && !comp_(*tree.select(tree.size() - 1), bounds_[i]))
+                return false;
+        }
+        return before_.back() == total;
+    }
+
+  private:
+    size_type shard_of(const KeyT &key) const {
+        return static_cast<size_type>(std::upper_bound(bounds_.begin(), bounds_.end(), key, comp_) -
+                                      bounds_.begin());
+    }
+
+    void recount() noexcept {
+        for (size_type i = 0; i < shards_.size(); ++i)
+            before_[i + 1] = before_[i] + shards_[i]->tree.size();
+    }
+
+    /// boundaries at the quantiles of an evenly strided sample of keys; none when the sample
+    /// has fewer distinct keys than there are shards
+    void sample_bounds(std::span<const KeyT> keys) {
+        const auto step = std::max<size_type>(1, keys.size() / (sample_per_shard * shards_.size()));
+        std::vector<KeyT> sample;
+        for (size_type i = 0; i < keys.size(); i += step)
+            sample.push_back(keys[i]);
+        std::sort(sample.begin(), sample.end(), comp_);
+        sample.erase(std::unique(sample.begin(), sample.end(),
+                                 [&](const KeyT &a, const KeyT &b) { return !comp_(a, b); }),
+                     sample.end());
+        if (sample.size() < shards_.size())
+            return;
+        for (size_type i = 1; i < shards_.size(); ++i)
+            bounds_.push_back(sample[i * sample.size() / shards_.size()]);
+    }
+
+    /// some shard holds over half as much again as an even share
+    bool unbalanced() const noexcept {
+        const auto p = shards_.size();
+        if (p == 1 || size() < p * min_rebalance_keys)
+            return false;
+        size_type largest = 0;
+        for (auto &shard : shards_)
+            largest = std::max(largest, shard->tree.size());
+        return 2 * p * largest > 3 * size();
+    }
+
+    /// redraws the boundaries at the exact quantiles and rebuilds every shard from its slice;
+    /// O(n), and the set must grow by a constant fraction before the next one, so amortized
+    /// O(shards) per key
+    void rebalance() {
+        std::vector<KeyT> keys;
+        keys.reserve(size());
+        for (auto &shard : shards_) {
+            for (const auto &key : shard->tree)
+                keys.push_back(key);
+            shard->tree.clear();
+        }
+
+        const auto n = keys.size();
+        const auto p = shards_.size();
+        bounds_.clear();
+        for (size_type i = 0; i < p; ++i) {
+            const auto first = keys.begin() + static_cast<std::ptrdiff_t>(i * n / p);
+            const auto last = keys.begin() + static_cast<std::ptrdiff_t>((i + 1) * n / p);
+            if (i != 0)
+                bounds_.push_back(*first);
+            shards_[i]->tree = tree_type::from_sorted(first, last);
+        }
+        recount();
+    }
+
+    /// the calling thread splits keys among the queues in small pushes while the workers drain
+    /// them, then seals every queue and waits for the shards to finish
+    size_type route(std::span<const KeyT> keys) {
+        const auto p = shards_.size();
+        std::vector<KeyT> stage(p * stage_size);
+        std::vector<size_type> staged(p, 0);
+        auto flush = [&](size_type s) {
+            push_all(*shards_[s], std::span<const KeyT>(stage.data() + s * stage_size, staged[s]));
+            staged[s] = 0;
+        };
+
+        for (const auto &key : keys) {
+            const auto s = shard_of(key);
+            stage[s * stage_size + staged[s]++] = key;
+            if (staged[s] == stage_size)
+                flush(s);
+        }
+        for (size_type s = 0; s < p; ++s) {
+            if (staged[s] != 0)
+                flush(s);
+            auto &shard = *shards_[s];
+            shard.sealed.store(shard.pushed, std::memory_order_release);
+            shard.wake.fetch_add(1, std::memory_order_release);
+            shard.wake.notify_one();
+        }
+
+        size_type inserted = 0;
+        for (auto &shard : shards_) {
+            for (auto done = shard->done.load(std::memory_order_acquire); done != shard->pushed;
+                 done = shard->done.load(std::memory_order_acquire))
+                shard->done.wait(done, std::memory_order_acquire);
+            inserted += std::exchange(shard->inserted, 0);
+        }
+        return inserted;
+    }
+
+    static void push_all(Shard &shard, std::span<const KeyT> items) {
+        for (;;) {
+            const auto n = shard.queue.push(items);
+            shard.pushed += n;
+            items = items.subspan(n);
+            shard.wake.fetch_add(1, std::memory_order_release);
+            shard.wake.notify_one();
+            if (items.empty())
+                return;
+            // the ring is full: let the worker drain it
+            std::this_thread::yield();
+        }
+    }
+
+    /// drains the queue into pending and inserts it as one batch once the producer has sealed
+    /// everything taken so far, so a shard sees the same batch sizes as a lone Tree would
+    void work(Shard &shard) {
+        std::vector<KeyT> pending;
+        size_type taken = 0;
+        auto insert_pending = [&] {
+            shard.inserted += shard.tree.insert_batch(pending);
+            shard.done.fetch_add(pending.size(), std::memory_order_release);
+            shard.done.notify_one();
+            pending.clear();
+        };
+
+        for (;;) {
+            // read before the pop, so a push or seal that lands after it is not slept through
+            const auto seen = shard.wake.load(std::memory_order_acquire);
+            const auto held = pending.size();
+            pending.resize(held + pop_size);
+            const auto n = shard.queue.pop(std::span<KeyT>(pending).subspan(held));
+            pending.resize(held + n);
+            taken += n;
+
+            if (pending.size() >= max_pending)
+                insert_pending();
+            else if (n != 0)
+                continue;
+            else if (!pending.empty() && shard.sealed.load(std::memory_order_acquire) == taken)
+                insert_pending();
+            else if (stop_.load(std::memory_order_acquire))
+                return;
+            else
+                shard.wake.wait(seen, std::memory_order_acquire);
+        }
+    }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_SHARDED_TREE_HPP
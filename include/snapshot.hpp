@@ -0,0 +1,298 @@
+#ifndef INCLUDE_SNAPSHOT_HPP
+#define INCLUDE_SNAPSHOT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <span>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+
+namespace RB_tree {
+
+/// On-disk image of a sorted key set: a 32-byte header followed by the keys in order, exactly as
+/// they sit in memory. The header holds "RQSN", the format version, sizeof(KeyT), the key count
+/// and a checksum of the key bytes, each field little-endian. Since the keys are stored raw, an
+/// image is read back on a machine with the byte order and key layout that wrote it.
+namespace snapshot {
+
+inline constexpr char magic[4] = {'R', 'Q', 'S', 'N'};
+inline constexpr std::uint32_t version = 1;
+inline constexpr std::size_t header_size = 32;
+
+/// 64-bit multiply-xor hash over four interleaved lanes of 8-byte words, so the four
+/// multiplication chains overlap; it catches torn and corrupted files, not tampering
+class Checksum final {
+  private:
+    static constexpr std::uint64_t prime = 0x9E3779B97F4A7C15;
+    static constexpr std::size_t stride = 32;
+
+    std::array<std::uint64_t, 4> lanes_ = {1, 2, 3, 4};
+    std::uint64_t bytes_ = 0;
+    unsigned char tail_[stride];
+    std::size_t tail_size_ = 0;
+
+  public:
+    void update(const void *data, std::size_t n) noexcept {
+        const auto *p = static_cast<const unsigned char *>(data);
+        bytes_ += n;
+        if (tail_size_ != 0) {
+            const auto take = std::min(n, stride - tail_size_);
+            std::memcpy(tail_ + tail_size_, p, take);
+            tail_size_ += take;
+            p += take;
+            n -= take;
+            if (tail_size_ < stride)
+                return;
+            mix(tail_);
+            tail_size_ = 0;
+        }
+        for (; n >= stride; p += stride, n -= stride)
+            mix(p);
+        std::memcpy(tail_, p, n);
+        tail_size_ = n;
+    }
+
+    std::uint64_t value() const noexcept {
+        auto lanes = lanes_;
+        unsigned char last[stride] = {};
+        std::memcpy(last, tail_, tail_size_);
+        if (tail_size_ != 0)
+            mix(lanes, last);
+        std::uint64_t h = bytes_;
+        for (auto lane : lanes)
+            h = mix_word(h, lane);
+        return h ^ (h >> 32);
+    }
+
+  private:
+    static std::uint64_t mix_word(std::uint64_t h, std::uint64_t word) noexcept {
+        h = (h ^ word) * prime;
+        return h ^ (h >> 29);
+    }
+
+    static void mix(std::array<std::uint64_t, 4> &lanes, const unsigned char *p) noexcept {
+        for (int i = 0; i < 4; ++i) {
+            std::uint64_t word;
+            std::memcpy(&word, p + 8 * i, sizeof(word));
+            lanes[i] = mix_word(lanes[i], word);
+        }
+    }
+
+    void mix(const unsigned char *p) noexcept { mix(lanes_, p); }
+};
+
+inline std::uint64_t checksum(const void *data, std::size_t n) noexcept {
+    Checksum sum;
+    sum.update(data, n);
+    return sum.value();
+}
+
+/// field values of a header
+struct Header {
+    std::uint32_t version = 0;
+    std::uint32_t key_size = 0;
+    std::uint64_t count = 0;
+    std::uint64_t checksum = 0;
+};
+
+inline void encode(const Header &header, unsigned char (&out)[header_size]) noexcept {
+    auto put = [&](std::size_t offset, std::uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i)
+            out[offset + i] = static_cast<unsigned char>((value >> (8 * i)) & 0xFF);
+    };
+    std::memcpy(out, magic, sizeof(magic));
+    put(4, header.version, 4);
+    put(8, header.key_size, 4);
+    put(12, 0, 4); // reserved
+    put(16, header.count, 8);
+    put(24, header.checksum, 8);
+}
+
+/// false when in does not start with the magic
+inline bool decode(const unsigned char *in, Header &header) noexcept {
+    auto get = [&](std::size_t offset, int bytes) {
+        std::uint64_t value = 0;
+        for (int i = 0; i < bytes; ++i)
+            value |= std::uint64_t{in[offset + i]} << (8 * i);
+        return value;
+    };
+    if (std::memcmp(in, magic, sizeof(magic)) != 0)
+        return false;
+    header.version = static_cast<std::uint32_t>(get(4, 4));
+    header.key_size = static_cast<std::uint32_t>(get(8, 4));
+    header.count = get(16, 8);
+    header.checksum = get(24, 8);
+    return true;
+}
+
+/// write(2) all of data; false on an I/O error
+inline bool write_all(int fd, const void *data, std::size_t n) noexcept {
+    const auto *p = static_cast<const char *>(data);
+    while (n != 0) {
+        const auto written = write(fd, p, n);
+        if (written > 0) {
+            p += written;
+            n -= static_cast<std::size_t>(written);
+        } else if (written == 0 || errno != EINTR) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace snapshot
+
+/// writes the n keys first walks, sorted and distinct, as a snapshot to the start of fd, which
+/// must be seekable (the header is written last, once the checksum is known); false on an I/O
+/// error
+template <std::input_iterator It>
+    requires std::is_trivially_copyable_v<std::iter_value_t<It>>
+bool write_snapshot(int fd, It first, std::size_t n) {
+    using KeyT = std::iter_value_t<It>;
+    constexpr std::size_t block_keys = (1 << 16) / sizeof(KeyT);
+
+    unsigned char header[snapshot::header_size] = {};
+    if (!snapshot::write_all(fd, header, sizeof(header)))
+        return false;
+
+    snapshot::Checksum sum;
+    KeyT block[block_keys];
+    for (std::size_t done = 0; done < n;) {
+        const auto count = std::min(block_keys, n - done);
+        for (std::size_t i = 0; i < count; ++i, ++first)
+            block[i] = *first;
+        sum.update(block, count * sizeof(KeyT));
+        if (!snapshot::write_all(fd, block, count * sizeof(KeyT)))
+            return false;
+        done += count;
+    }
+
+    snapshot::encode({snapshot::version, sizeof(KeyT), n, sum.value()}, header);
+    return pwrite(fd, header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header));
+}
+
+/// snapshot of any sorted container
+template <typename C> bool write_snapshot(int fd, const C &sorted) {
+    return write_snapshot(fd, sorted.begin(), sorted.size());
+}
+
+/// snapshot mapped read-only and queried in place: rank and count_in_range are binary searches
+/// over the mapped keys, so a restart answers its first query as soon as the header is checked.
+/// begin() and end() walk the keys in order for Tree::from_sorted or Eytzinger_index
+template <typename KeyT, typename Compare = std::less<KeyT>> class Snapshot_view final {
+    static_assert(std::is_trivially_copyable_v<KeyT>);
+
+  public:
+    using size_type = std::size_t;
+    using const_iterator = const KeyT *;
+
+  private:
+    void *map_ = nullptr;
+    std::size_t map_size_ = 0;
+    const KeyT *keys_ = nullptr;
+    size_type size_ = 0;
+    std::uint64_t checksum_ = 0;
+    bool valid_ = false;
+    Compare comp_;
+
+  public:
+    explicit Snapshot_view(int fd, const Compare &comp = Compare()) : comp_(comp) {
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) ||
+            static_cast<std::size_t>(st.st_size) < snapshot::header_size)
+            return;
+
+        map_size_ = static_cast<std::size_t>(st.st_size);
+        map_ = mmap(nullptr, map_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map_ == MAP_FAILED) {
+            map_ = nullptr;
+            return;
+        }
+
+        const auto *bytes = static_cast<const unsigned char *>(map_);
+        snapshot::Header header;
+        if (!snapshot::decode(bytes, header) || header.version != snapshot::version ||
+            header.key_size != sizeof(KeyT) ||
+            header.count != (map_size_ - snapshot::header_size) / sizeof(KeyT) ||
+            (map_size_ - snapshot::header_size) % sizeof(KeyT) != 0)
+            return;
+
+        // the header size keeps the keys aligned for any key up to 32 bytes
+        static_assert(alignof(KeyT) <= snapshot::header_size);
+        keys_ = reinterpret_cast<const KeyT *>(bytes + snapshot::header_size);
+        size_ = static_cast<size_type>(header.count);
+        checksum_ = header.checksum;
+        valid_ = true;
+    }
+
+    Snapshot_view(const Snapshot_view &) = delete;
+    Snapshot_view &operator=(const Snapshot_view &) = delete;
+
+    ~Snapshot_view() {
+        if (map_)
+            munmap(map_, map_size_);
+    }
+
+    /// false when the file is missing, not mappable or its header does not describe it
+    bool valid() const noexcept { return valid_; }
+
+    /// reads every key once and compares the checksum with the header
+    [[nodiscard]] bool verify() const noexcept {
+        return valid_ && snapshot::checksum(keys_, size_ * sizeof(KeyT)) == checksum_;
+    }
+
+    Compare key_comp() const { return comp_; }
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    const_iterator begin() const noexcept { return keys_; }
+    const_iterator end() const noexcept { return keys_ + size_; }
+    std::span<const KeyT> keys() const noexcept { return {keys_, size_}; }
+
+    /// number of keys less than key
+    size_type rank(const KeyT &key) const {
+        return search([&](const KeyT &k) { return comp_(k, key); });
+    }
+
+    /// number of keys not greater than key
+    size_type upper_rank(const KeyT &key) const {
+        return search([&](const KeyT &k) { return !comp_(key, k); });
+    }
+
+    /// number of keys in [lo, hi], 0 when hi < lo
+    size_type count_in_range(const KeyT &lo, const KeyT &hi) const {
+        if (comp_(hi, lo))
+            return 0;
+        return upper_rank(hi) - rank(lo);
+    }
+
+    /// k-th smallest key counting from 0, nullptr when k >= size()
+    const KeyT *select(size_type k) const noexcept { return k < size_ ? keys_ + k : nullptr; }
+
+  private:
+    /// number of leading keys for which before(key) holds; branchless halving, so the loads of
+    /// one search do not wait on mispredicted comparisons
+    template <typename Before> size_type search(Before before) const {
+        const KeyT *base = keys_;
+        size_type n = size_;
+        while (n > 1) {
+            const auto half = n / 2;
+            base = before(base[half]) ? base + half : base;
+            n -= half;
+        }
+        return static_cast<size_type>(base - keys_) + (n == 1 && before(*base) ? 1 : 0);
+    }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_SNAPSHOT_HPP
@@ -0,0 +1,79 @@
+#ifndef INCLUDE_SPSC_QUEUE_HPP
+#define INCLUDE_SPSC_QUEUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <span>
+
+namespace RB_tree {
+
+/// bounded ring buffer between exactly one producer thread and one consumer thread. head_ and
+/// tail_ only ever grow; each side keeps a cached copy of the other side's index on its own
+/// cache line, so it reads the shared one only when the cached copy says the ring looks full or
+/// empty
+template <typename T> class Spsc_queue final {
+  public:
+    using size_type = std::size_t;
+
+  private:
+    static constexpr size_type cache_line = 64;
+
+    std::unique_ptr<T[]> slots_;
+    size_type mask_;
+
+    struct alignas(cache_line) Consumer {
+        std::atomic<size_type> head{0}; // next slot to pop
+        size_type tail = 0;             // last tail seen
+    };
+    struct alignas(cache_line) Producer {
+        std::atomic<size_type> tail{0}; // next slot to push
+        size_type head = 0;             // last head seen
+    };
+
+    Consumer consumer_;
+    Producer producer_;
+
+  public:
+    /// capacity is rounded up to a power of two
+    explicit Spsc_queue(size_type capacity)
+        : slots_(std::make_unique<T[]>(std::bit_ceil(std::max<size_type>(capacity, 2)))),
+          mask_(std::bit_ceil(std::max<size_type>(capacity, 2)) - 1) {}
+
+    Spsc_queue(const Spsc_queue &) = delete;
+    Spsc_queue &operator=(const Spsc_queue &) = delete;
+
+    size_type capacity() const noexcept { return mask_ + 1; }
+
+    /// producer: appends a prefix of items, as much as there is room for, and returns its length
+    size_type push(std::span<const T> items) {
+        const auto tail = producer_.tail.load(std::memory_order_relaxed);
+        if (capacity() - (tail - producer_.head) < items.size())
+            producer_.head = consumer_.head.load(std::memory_order_acquire);
+
+        const auto n = std::min(items.size(), capacity() - (tail - producer_.head));
+        for (size_type i = 0; i < n; ++i)
+            slots_[(tail + i) & mask_] = items[i];
+        producer_.tail.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    /// consumer: moves up to out.size() of the oldest items into out and returns their number
+    size_type pop(std::span<T> out) {
+        const auto head = consumer_.head.load(std::memory_order_relaxed);
+        if (consumer_.tail - head < out.size())
+            consumer_.tail = producer_.tail.load(std::memory_order_acquire);
+
+        const auto n = std::min(out.size(), consumer_.tail - head);
+        for (size_type i = 0; i < n; ++i)
+            out[i] = std::move(slots_[(head + i) & mask_]);
+        consumer_.head.store(head + n, std::memory_order_release);
+        return n;
+    }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_SPSC_QUEUE_HPP
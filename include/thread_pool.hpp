@@ -0,0 +1,127 @@
+#ifndef INCLUDE_THREAD_POOL_HPP
+#define INCLUDE_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace RB_tree {
+
+/// fixed set of worker threads that split index ranges into chunks; the calling thread works too
+class Thread_pool final {
+  public:
+    using size_type = std::size_t;
+
+  private:
+    std::vector<std::jthread> workers_;
+
+    // written by the caller before generation_ is bumped, read-only while a job runs
+    std::function<void(size_type, size_type)> job_;
+    size_type job_size_ = 0;
+    size_type chunk_ = 1;
+    bool stop_ = false;
+
+    std::atomic<size_type> next_{0};
+    std::atomic<size_type> busy_{0};
+    std::atomic<unsigned long> generation_{0};
+
+  public:
+    /// threads counts the caller, so Thread_pool(1) starts no workers
+    explicit Thread_pool(size_type threads) {
+        threads = std::max<size_type>(threads, 1);
+        workers_.reserve(threads - 1);
+        for (size_type i = 1; i < threads; ++i)
+            workers_.emplace_back([this] { work(); });
+    }
+
+    Thread_pool(const Thread_pool &) = delete;
+    Thread_pool &operator=(const Thread_pool &) = delete;
+
+    ~Thread_pool() {
+        stop_ = true;
+        generation_.fetch_add(1, std::memory_order_release);
+        generation_.notify_all();
+        workers_.clear();
+    }
+
+    size_type size() const noexcept { return workers_.size() + 1; }
+
+    /// calls body(begin, end) over disjoint chunks covering [0, n) and returns when all are done
+    template <typename Body> void parallel_for(size_type n, Body &&body) {
+        // below a few chunks per thread the wake-up costs more than the work
+        if (workers_.empty() || n < 2 * min_chunk) {
+            if (n != 0)
+                body(size_type{0}, n);
+            return;
+        }
+
+        run(n, std::max(min_chunk, n / (size() * chunks_per_thread)), body);
+    }
+
+    /// calls task(i) for every i in [0, tasks), each claimed on its own, and returns when all are
+    /// done; for a few coarse tasks, such as the pieces of a sort, that parallel_for would run
+    /// on one thread
+    template <typename Task> void run_tasks(size_type tasks, Task &&task) {
+        auto body = [&](size_type begin, size_type end) {
+            for (auto i = begin; i != end; ++i)
+                task(i);
+        };
+        if (workers_.empty() || tasks < 2)
+            body(size_type{0}, tasks);
+        else
+            run(tasks, 1, body);
+    }
+
+  private:
+    static constexpr size_type min_chunk = 64;
+    static constexpr size_type chunks_per_thread = 8;
+
+    template <typename Body> void run(size_type n, size_type chunk, Body &body) {
+        job_ = std::ref(body);
+        job_size_ = n;
+        chunk_ = chunk;
+        next_.store(0, std::memory_order_relaxed);
+        busy_.store(workers_.size(), std::memory_order_relaxed);
+        generation_.fetch_add(1, std::memory_order_release);
+        generation_.notify_all();
+
+        run_chunks();
+
+        for (auto busy = busy_.load(std::memory_order_acquire); busy != 0;
+             busy = busy_.load(std::memory_order_acquire))
+            busy_.wait(busy, std::memory_order_acquire);
+        job_ = nullptr;
+    }
+
+    /// claims chunks until the current job runs out; faster threads simply claim more of them
+    void run_chunks() {
+        for (;;) {
+            const auto begin = next_.fetch_add(chunk_, std::memory_order_relaxed);
+            if (begin >= job_size_)
+                return;
+            job_(begin, std::min(begin + chunk_, job_size_));
+        }
+    }
+
+    void work() {
+        unsigned long seen = 0;
+        for (;;) {
+            generation_.wait(seen, std::memory_order_acquire);
+            seen = generation_.load(std::memory_order_acquire);
+            if (stop_)
+                return;
+
+            run_chunks();
+
+            if (busy_.fetch_sub(1, std::memory_order_release) == 1)
+                busy_.notify_one();
+        }
+    }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_THREAD_POOL_HPP
@@ -1,13 +1,26 @@
 #ifndef INCLUDE_TREE_HPP
 #define INCLUDE_TREE_HPP
 
+#include "arena.hpp"
+#include "augment.hpp"
 #include "iterator.hpp"
 #include "node.hpp"
+#include "parallel_sort.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
 #include <cassert>
 #include <filesystem>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 struct Dump_paths {
     std::filesystem::path gv;
@@ -35,80 +48,303 @@ inline Dump_paths make_dump_paths(std::string_view basename = "graph_dump",
 
 namespace RB_tree {
 
-template <typename KeyT, typename Compare = std::less<KeyT>> class Tree final {
+/// Augment is the monoid range_aggregate folds; Count_augment, the default, is the subtree size
+/// every node keeps for rank and select, so a counting tree carries no extra field
+template <typename KeyT, typename Compare = std::less<KeyT>,
+          typename Allocator = Arena_allocator<KeyT>, typename Augment = Count_augment>
+class Tree final {
+    static_assert(Augment_policy<Augment, KeyT>);
+    static constexpr bool augmented = !std::is_same_v<Augment, Count_augment>;
+
+  public:
+    using node_type =
+        std::conditional_t<augmented, Augmented_node<KeyT, Augment>, Node<KeyT>>;
+    using allocator_type =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>;
+    using iterator = RB_tree::Iterator<KeyT>;
+    using size_type = std::size_t;
+    using aggregate_type = typename Augment::value_type;
+
   private:
-    Node<KeyT> *nil_;
+    using node_traits = std::allocator_traits<allocator_type>;
+
+    [[no_unique_address]] allocator_type alloc_;
+    Node<KeyT> *nil_; // sentinel(), shared by every tree of this type
     Node<KeyT> *root_;
     Node<KeyT> *begin_node;
+    Node<KeyT> *last_node;
     Compare comp_;
 
   public:
-    Tree() : nil_(new Node<KeyT>()), root_(nil_), begin_node(nil_) {}
+    Tree() : alloc_(), nil_(sentinel()), root_(nil_), begin_node(nil_), last_node(nil_) {}
+
+    explicit Tree(const Allocator &alloc)
+        : alloc_(alloc), nil_(sentinel()), root_(nil_), begin_node(nil_), last_node(nil_) {}
 
-    ~Tree() {
-        destroy_subtree(root_);
-        delete nil_;
+    ~Tree() { release(); }
+
+    /// builds a balanced tree from keys sorted by Compare; repeated keys are stored once
+    template <std::forward_iterator It>
+    static Tree from_sorted(It first, It last, const Allocator &alloc = Allocator()) {
+        Tree tree(alloc);
+        tree.build_sorted(first, last);
+        return tree;
+    }
+
+    /// from_sorted across the pool: the nodes are allocated as one block, the top levels are
+    /// built first and every subtree below them is a task of its own
+    template <std::random_access_iterator It>
+    static Tree from_sorted(It first, It last, Thread_pool &pool,
+                            const Allocator &alloc = Allocator()) {
+        Tree tree(alloc);
+        tree.build_parallel(first, last, pool);
+        return tree;
     }
 
     Compare key_comp() const { return comp_; }
 
+    allocator_type get_allocator() const { return alloc_; }
+
     Tree(const Tree &) = delete;
     Tree(Tree &&other) noexcept
-        : nil_(other.nil_), root_(other.root_), begin_node(other.begin_node),
+        : alloc_(std::move(other.alloc_)), nil_(other.nil_), root_(other.root_),
+          begin_node(other.begin_node), last_node(other.last_node),
           comp_(std::move(other.comp_)) {
-        other.nil_ = nullptr;
-        other.root_ = nullptr;
-        other.begin_node = nullptr;
+        other.root_ = other.nil_;
+        other.begin_node = other.nil_;
+        other.last_node = other.nil_;
     }
     Tree &operator=(const Tree &) = delete;
     Tree &operator=(Tree &&other) noexcept {
         if (this != &other) {
-            destroy_subtree(root_);
-            delete nil_;
+            release();
 
-            nil_ = other.nil_;
+            alloc_ = std::move(other.alloc_);
             root_ = other.root_;
             begin_node = other.begin_node;
+            last_node = other.last_node;
             comp_ = std::move(other.comp_);
 
-            other.nil_ = nullptr;
-            other.root_ = nullptr;
-            other.begin_node = nullptr;
+            other.root_ = other.nil_;
+            other.begin_node = other.nil_;
+            other.last_node = other.nil_;
         }
         return *this;
     }
 
     void dump_graph() const;
 
-    bool insert(const KeyT &key) {
-        auto *new_node = new Node<KeyT>(key);
-        Node<KeyT> *parent = nil_;
-        auto current = root_;
+    bool insert(const KeyT &key) { return insert_from(root_, key).second; }
 
-        if (!tree_descent(current, parent, key))
-            return false;
+    /// inserts key starting from the node of hint instead of the root and returns the iterator
+    /// to the key; amortized O(1) descent work when the key lands next to hint, as with
+    /// monotonic or near-sorted input (end() stands for the largest key)
+    iterator insert(iterator hint, const KeyT &key) {
+        return insert_from(finger_search(hint_node(hint), key), key).first;
+    }
 
-        new_node->set_parent(parent);
-        if (parent->is_nil())
-            root_ = new_node;
-        else if (comp_(key, parent->get_key()))
-            parent->set_left(new_node);
+    size_type size() const noexcept { return root_->size_; }
+    bool empty() const noexcept { return root_->is_nil(); }
+
+    void clear() {
+        if (nodes_released_with_allocator())
+            alloc_ = allocator_type();
         else
-            parent->set_right(new_node);
+            destroy_subtree(root_);
 
-        new_node->set_left(nil_);
-        new_node->set_right(nil_);
+        root_ = nil_;
+        begin_node = nil_;
+        last_node = nil_;
+    }
 
-        fix_insert(new_node);
+    /// replaces the contents with the keys of range: sorts them, drops repeated keys and builds
+    /// a balanced tree in linear time
+    template <std::ranges::input_range R> void assign(R &&range) {
+        std::vector<KeyT> keys(std::ranges::begin(range), std::ranges::end(range));
+        std::sort(keys.begin(), keys.end(), comp_);
 
-        if (begin_node->is_nil() || comp_(key, begin_node->get_key())) {
-            begin_node = new_node;
+        clear();
+        build_sorted(keys.begin(), keys.end());
+    }
+
+    /// removes key, returns the number of removed keys (0 or 1)
+    size_type erase(const KeyT &key) {
+        auto *node = find_node(key);
+        if (node->is_nil())
+            return 0;
+
+        erase_node(node);
+        return 1;
+    }
+
+    /// removes the key at pos, returns the iterator past it
+    iterator erase(iterator pos) {
+        assert(pos != end());
+        auto next = std::next(pos);
+        erase_node(const_cast<Node<KeyT> *>(pos.get()));
+        return next;
+    }
+
+    /// inserts a batch of keys and returns how many of them were new; the batch is sorted and
+    /// every insert starts from the previous insertion point instead of the root, while a batch
+    /// that is large compared to the tree is merged with it and rebuilt in linear time
+    size_type insert_batch(std::span<const KeyT> keys) {
+        if (keys.empty())
+            return 0;
+
+        std::vector<KeyT> sorted(keys.begin(), keys.end());
+        std::sort(sorted.begin(), sorted.end(), comp_);
+
+        const size_type old_size = size();
+        if (old_size == 0) {
+            build_sorted(sorted.begin(), sorted.end());
+            return size();
         }
 
-        return true;
+        if (prefers_rebuild(sorted.size())) {
+            std::vector<KeyT> merged;
+            merged.reserve(old_size + sorted.size());
+            std::merge(begin(), end(), sorted.begin(), sorted.end(), std::back_inserter(merged),
+                       comp_);
+
+            clear();
+            build_sorted(merged.begin(), merged.end());
+            return size() - old_size;
+        }
+
+        Node<KeyT> *finger = root_;
+        for (const auto &key : sorted)
+            finger = insert_from(finger_search(finger, key), key).first;
+        return size() - old_size;
     }
 
-    using iterator = RB_tree::Iterator<KeyT>;
+    /// insert_batch across the pool. The batch is sorted with parallel_sort; an empty tree, or
+    /// one the batch would rebuild, is rebuilt with a parallel merge and build. Otherwise the
+    /// tree is split at quantiles of the batch, every piece takes its keys by finger inserts
+    /// into a slice of one preallocated block of nodes, and the pieces are joined back. No
+    /// thread allocates, so the shared arena needs no lock
+    size_type insert_batch(std::span<const KeyT> keys, Thread_pool &pool) {
+        if constexpr (!is_slab_allocator_v<allocator_type>) {
+            return insert_batch(keys);
+        } else {
+            if (pool.size() == 1 || keys.size() < parallel::min_keys_per_task)
+                return insert_batch(keys);
+
+            std::vector<KeyT> sorted(keys.begin(), keys.end());
+            parallel_sort(std::span<KeyT>(sorted), comp_, pool);
+
+            const size_type old_size = size();
+            if (old_size == 0) {
+                build_parallel(sorted.begin(), sorted.end(), pool);
+                return size();
+            }
+            if (prefers_rebuild(sorted.size())) {
+                std::vector<KeyT> current;
+                current.reserve(old_size);
+                for (const auto &key : *this)
+                    current.push_back(key);
+                std::vector<KeyT> merged(old_size + sorted.size());
+                parallel_merge(std::span<const KeyT>(current), std::span<const KeyT>(sorted),
+                               std::span<KeyT>(merged), comp_, pool);
+
+                clear();
+                build_parallel(merged.begin(), merged.end(), pool);
+                return size() - old_size;
+            }
+
+            insert_pieces(sorted, pool);
+            return size() - old_size;
+        }
+    }
+
+    /// moves the keys not less than key into the returned tree, which allocates from a copy of
+    /// the allocator of *this; O(log n), no key is copied
+    Tree split(const KeyT &key) {
+        Tree right{Allocator(alloc_)};
+        auto parts = split_subtree(root_, black_height(root_), key);
+        if (!parts.equal->is_nil())
+            std::tie(parts.right, parts.right_height) =
+                join_subtrees(nil_, 0, parts.equal, parts.right, parts.right_height);
+
+        adopt(parts.left);
+        right.adopt(parts.right);
+        return right;
+    }
+
+    /// appends the keys of other, which must all be greater than the keys of *this, and leaves
+    /// other empty. O(log n) when the allocators compare equal (a tree and the trees split off
+    /// it, say), otherwise the keys of other are copied in and its nodes freed
+    void join(Tree &&other) {
+        if (other.empty())
+            return;
+        assert(empty() || comp_(last_node->get_key(), other.begin_node->get_key()));
+        if (!(alloc_ == other.alloc_)) {
+            insert_copies(std::move(other));
+            return;
+        }
+        if (empty()) {
+            std::swap(root_, other.root_);
+            std::swap(begin_node, other.begin_node);
+            std::swap(last_node, other.last_node);
+            return;
+        }
+
+        // the smallest key of other becomes the node that joins the two trees
+        auto *middle = other.begin_node;
+        other.unlink_node(middle);
+        const auto joined = join_subtrees(root_, black_height(root_), middle, other.root_,
+                                          black_height(other.root_));
+        other.adopt(nil_);
+        adopt(joined.first);
+    }
+
+    /// moves every key of other into *this, drops the keys both hold and returns how many keys
+    /// were added. With equal allocators nodes are relinked, not copied: the union splits other
+    /// at the keys of *this and joins the pieces, O(m log(n / m + 1)) for trees of n and m
+    /// keys, and O(log n) when the key ranges do not overlap
+    size_type merge(Tree &&other) {
+        const size_type old_size = size();
+        if (other.empty())
+            return 0;
+        if (!(alloc_ == other.alloc_)) {
+            insert_copies(std::move(other));
+            return size() - old_size;
+        }
+        if (empty() || comp_(last_node->get_key(), other.begin_node->get_key())) {
+            join(std::move(other));
+            return size() - old_size;
+        }
+        if (comp_(other.last_node->get_key(), begin_node->get_key())) {
+            other.join(std::move(*this));
+            *this = std::move(other);
+            return size() - old_size;
+        }
+
+        auto *root = union_subtrees(root_, black_height(root_), other.root_,
+                                    black_height(other.root_))
+                         .first;
+        other.adopt(nil_);
+        adopt(root);
+        return size() - old_size;
+    }
+
+    /// checks ordering, coloring, black heights, sizes and parent links of the whole tree
+    [[nodiscard]] bool check_invariants() const {
+        if (root_->is_nil())
+            return begin_node->is_nil() && last_node->is_nil();
+        if (root_->is_red() || !root_->get_parent()->is_nil())
+            return false;
+
+        const Node<KeyT> *leftmost = root_;
+        while (!leftmost->get_left()->is_nil())
+            leftmost = leftmost->get_left();
+        const Node<KeyT> *rightmost = root_;
+        while (!rightmost->get_right()->is_nil())
+            rightmost = rightmost->get_right();
+
+        return leftmost == begin_node && rightmost == last_node &&
+               check_subtree(root_, nullptr, nullptr) != -1;
+    }
 
     iterator begin() { return begin_node; }
     iterator begin() const { return begin_node; }
@@ -117,33 +353,57 @@ template <typename KeyT, typename Compare = std::less<KeyT>> class Tree final {
 
     iterator lower_bound(const KeyT &key) const {
         const Node<KeyT> *candidate = nil_;
-        const Node<KeyT> *current = root_;
+        for (const Node<KeyT> *current = root_; !current->is_nil();)
+            bound_step<true>(current, candidate, key);
+        return candidate;
+    }
 
-        while (!current->is_nil()) {
+    /// lower_bound that searches from the node of hint instead of the root
+    iterator lower_bound(iterator hint, const KeyT &key) const {
+        const Node<KeyT> *start = finger_search<const Node<KeyT>>(hint_node(hint), key);
+        if (start == last_node && comp_(start->get_key(), key))
+            return end();
+
+        const Node<KeyT> *candidate = nil_;
+        for (const Node<KeyT> *current = start; !current->is_nil();) {
             if (comp_(current->get_key(), key))
-                if (comp_(current->get_key(), key))
-                    current = current->get_right();
-                else
-                    candidate = std::exchange(current, current->get_left());
+                current = current->get_right();
             else
                 candidate = std::exchange(current, current->get_left());
         }
-        return candidate;
+        if (!candidate->is_nil())
+            return candidate;
+
+        // every key of the subtree is smaller: the answer is its in-order successor
+        while (!start->get_parent()->is_nil() && start == start->get_parent()->get_right())
+            start = start->get_parent();
+        return start->get_parent();
     }
 
     iterator upper_bound(const KeyT &key) const {
         const Node<KeyT> *candidate = nil_;
-        const Node<KeyT> *current = root_;
+        for (const Node<KeyT> *current = root_; !current->is_nil();)
+            bound_step<false>(current, candidate, key);
+        return candidate;
+    }
 
-        while (!current->is_nil()) {
-            if (comp_(key, current->get_key()))
-                candidate = std::exchange(current, current->get_left());
-            else if (comp_(key, current->get_key()))
-                candidate = std::exchange(current, current->get_left());
-            else
-                current = current->get_right();
+    /// {lower_bound(lo), upper_bound(hi)} from two descents advanced in lockstep, so the cache
+    /// misses of one overlap those of the other
+    std::pair<iterator, iterator> bounds(const KeyT &lo, const KeyT &hi) const {
+        const Node<KeyT> *lower = nil_;
+        const Node<KeyT> *upper = nil_;
+        const Node<KeyT> *lo_node = root_;
+        const Node<KeyT> *hi_node = root_;
+
+        while (!lo_node->is_nil() && !hi_node->is_nil()) {
+            bound_step<true>(lo_node, lower, lo);
+            bound_step<false>(hi_node, upper, hi);
         }
-        return candidate;
+        while (!lo_node->is_nil())
+            bound_step<true>(lo_node, lower, lo);
+        while (!hi_node->is_nil())
+            bound_step<false>(hi_node, upper, hi);
+        return {lower, upper};
     }
 
     iterator::difference_type log_distance(iterator first, iterator last) const {
@@ -153,7 +413,776 @@ template <typename KeyT, typename Compare = std::less<KeyT>> class Tree final {
         return get_rank(last.get()) - get_rank(first.get());
     }
 
+    /// number of keys less than key, counted in a single top-down descent
+    size_type rank(const KeyT &key) const {
+        size_type rank = 0;
+        for (const Node<KeyT> *current = root_; !current->is_nil();)
+            rank_step<true>(current, rank, key);
+        return rank;
+    }
+
+    /// number of keys in [lo, hi]; the descents for both ends run interleaved
+    size_type count_in_range(const KeyT &lo, const KeyT &hi) const {
+        if (comp_(hi, lo))
+            return 0;
+
+        size_type below_lo = 0;
+        size_type up_to_hi = 0;
+        const Node<KeyT> *lo_node = root_;
+        const Node<KeyT> *hi_node = root_;
+
+        while (!lo_node->is_nil() && !hi_node->is_nil()) {
+            rank_step<true>(lo_node, below_lo, lo);
+            rank_step<false>(hi_node, up_to_hi, hi);
+        }
+        while (!lo_node->is_nil())
+            rank_step<true>(lo_node, below_lo, lo);
+        while (!hi_node->is_nil())
+            rank_step<false>(hi_node, up_to_hi, hi);
+        return up_to_hi - below_lo;
+    }
+
+    /// out[i] = count_in_range(queries[i].first, queries[i].second) for every query, answered
+    /// Group queries at a time: the 2 * Group rank descents of a group advance one level per
+    /// round in lockstep and prefetch the node they move to, so their cache misses overlap; with
+    /// the default 8 descents per group every lane stays in registers
+    template <std::size_t Group = 4, typename Count>
+    void count_in_range_batch(std::span<const std::pair<KeyT, KeyT>> queries,
+                              std::span<Count> out) const {
+        static_assert(Group > 0);
+        assert(out.size() >= queries.size());
+        std::size_t first = 0;
+        // full groups have a fixed size, so their lanes are indexed with constants
+        for (; first + Group <= queries.size(); first += Group)
+            count_group<Group>(queries.subspan(first).template first<Group>(),
+                               out.subspan(first).template first<Group>());
+        if (first < queries.size())
+            count_group<Group>(queries.subspan(first), out.subspan(first, queries.size() - first));
+    }
+
+    /// Augment fold of the keys in [lo, hi] in key order, identity() when hi < lo; one descent
+    /// to the node where the paths to lo and hi split, then one down each side of it
+    aggregate_type range_aggregate(const KeyT &lo, const KeyT &hi) const {
+        if constexpr (!augmented)
+            return count_in_range(lo, hi);
+        else {
+            if (comp_(hi, lo))
+                return Augment::identity();
+
+            const Node<KeyT> *split = root_;
+            while (!split->is_nil()) {
+                if (comp_(split->get_key(), lo))
+                    split = split->get_right();
+                else if (comp_(hi, split->get_key()))
+                    split = split->get_left();
+                else
+                    break;
+            }
+            if (split->is_nil())
+                return Augment::identity();
+
+            // keys not less than lo under the left child: every node kept on the way down
+            // precedes, with its right subtree, what was kept before it
+            auto left = Augment::identity();
+            for (const Node<KeyT> *node = split->get_left(); !node->is_nil();) {
+                if (comp_(node->get_key(), lo)) {
+                    node = node->get_right();
+                } else {
+                    left = Augment::combine(Augment::combine(Augment::lift(node->get_key()),
+                                                             aggregate_of(node->get_right())),
+                                            left);
+                    node = node->get_left();
+                }
+            }
+
+            auto right = Augment::identity();
+            for (const Node<KeyT> *node = split->get_right(); !node->is_nil();) {
+                if (comp_(hi, node->get_key())) {
+                    node = node->get_left();
+                } else {
+                    right = Augment::combine(right,
+                                             Augment::combine(aggregate_of(node->get_left()),
+                                                              Augment::lift(node->get_key())));
+                    node = node->get_right();
+                }
+            }
+
+            return Augment::combine(Augment::combine(left, Augment::lift(split->get_key())), right);
+        }
+    }
+
+    /// Augment fold of all keys
+    aggregate_type aggregate() const { return aggregate_of(root_); }
+
+    /// k-th smallest key counting from 0, end() when k >= size()
+    iterator select(size_type k) const {
+        const Node<KeyT> *current = root_;
+
+        while (!current->is_nil()) {
+            const auto left_size = current->get_left()->size_;
+            if (k < left_size)
+                current = current->get_left();
+            else if (k == left_size)
+                return current;
+            else {
+                k -= left_size + 1;
+                current = current->get_right();
+            }
+        }
+        return end();
+    }
+
   private:
+    /// one subtree below the top levels of build_parallel
+    struct Build_task {
+        size_type offset;
+        size_type n;
+        int depth;
+        Node<KeyT> *parent;
+        bool right;
+    };
+
+    static constexpr size_type build_tasks_per_thread = 4;
+
+    /// inserts key into the subtree of start, which must span the position of key; returns the
+    /// node holding the key and whether it was inserted
+    std::pair<Node<KeyT> *, bool> insert_from(Node<KeyT> *start, const KeyT &key) {
+        return insert_from(start, key, [&] { return create_node(key); });
+    }
+
+    /// insert_from with the node of a new key made by make_node()
+    template <typename Make>
+    std::pair<Node<KeyT> *, bool> insert_from(Node<KeyT> *start, const KeyT &key,
+                                              Make make_node) {
+        Node<KeyT> *parent = start->get_parent();
+        auto current = start;
+
+        if (!tree_descent(current, parent, key))
+            return {current, false};
+
+        Node<KeyT> *new_node = make_node();
+        new_node->set_parent(parent);
+        if (parent->is_nil())
+            root_ = new_node;
+        else if (comp_(key, parent->get_key()))
+            parent->set_left(new_node);
+        else
+            parent->set_right(new_node);
+
+        new_node->set_left(nil_);
+        new_node->set_right(nil_);
+
+        fix_insert(new_node);
+
+        if (begin_node->is_nil() || comp_(key, begin_node->get_key())) {
+            begin_node = new_node;
+        }
+        if (last_node->is_nil() || comp_(last_node->get_key(), key))
+            last_node = new_node;
+
+        return {new_node, true};
+    }
+
+    Node<KeyT> *hint_node(iterator hint) const noexcept {
+        // the tree owns every node, the iterator only hands them out as const
+        return const_cast<Node<KeyT> *>(hint == end() ? last_node : hint.get());
+    }
+
+    /// lowest ancestor of finger (or finger itself) whose subtree spans the position of key
+    template <typename NodeT> NodeT *finger_search(NodeT *finger, const KeyT &key) const {
+        if (finger->is_nil())
+            return root_;
+
+        const bool key_is_greater = comp_(finger->get_key(), key);
+        if (!key_is_greater && !comp_(key, finger->get_key()))
+            return finger;
+
+        // everything past the extreme keys hangs off the extreme nodes
+        if (finger == (key_is_greater ? last_node : begin_node))
+            return finger;
+
+        auto node = finger;
+        while (!node->get_parent()->is_nil()) {
+            const auto parent = node->get_parent();
+            if (key_is_greater ? node == parent->get_left() && comp_(key, parent->get_key())
+                               : node == parent->get_right() && comp_(parent->get_key(), key))
+                break;
+            node = parent;
+        }
+        return node;
+    }
+
+    /// merging m sorted keys with the tree costs O(n + m), m finger inserts about O(m log n)
+    bool prefers_rebuild(size_type m) const noexcept {
+        size_type log_n = 1;
+        for (auto n = size(); n > 1; n >>= 1)
+            ++log_n;
+        return m * log_n >= size();
+    }
+
+    void release() noexcept {
+        if (!nodes_released_with_allocator())
+            destroy_subtree(root_);
+    }
+
+    /// black height of the subtree, -1 when any invariant is broken
+    int check_subtree(const Node<KeyT> *node, const KeyT *lo, const KeyT *hi) const {
+        if (node->is_nil())
+            return 0;
+
+        const auto left = node->get_left();
+        const auto right = node->get_right();
+
+        if ((lo && !comp_(*lo, node->get_key())) || (hi && !comp_(node->get_key(), *hi)))
+            return -1;
+        if (node->size_ != 1 + left->size_ + right->size_)
+            return -1;
+        if constexpr (augmented)
+            if (!(aggregate_of(node) ==
+                  Augment::combine(Augment::combine(aggregate_of(left),
+                                                    Augment::lift(node->get_key())),
+                                   aggregate_of(right))))
+                return -1;
+        if ((!left->is_nil() && left->get_parent() != node) ||
+            (!right->is_nil() && right->get_parent() != node))
+            return -1;
+        if (node->is_red() && (left->is_red() || right->is_red()))
+            return -1;
+
+        const int left_height = check_subtree(left, lo, &node->get_key());
+        const int right_height = check_subtree(right, &node->get_key(), hi);
+        if (left_height == -1 || left_height != right_height)
+            return -1;
+
+        return left_height + (node->is_black() ? 1 : 0);
+    }
+
+    /// the nil-sentinel every tree of this type shares: it links to itself and is never
+    /// written, so split and join move subtrees between trees without touching their leaves
+    static Node<KeyT> *sentinel() noexcept {
+        static node_type nil;
+        return &nil;
+    }
+
+    /// number of black nodes on a path from node down to the nil-sentinel; O(log n)
+    static int black_height(const Node<KeyT> *node) noexcept {
+        int height = 0;
+        for (; !node->is_nil(); node = node->get_left())
+            height += node->is_black() ? 1 : 0;
+        return height;
+    }
+
+    /// makes the subtree of root, a detached root, the whole tree
+    void adopt(Node<KeyT> *root) noexcept {
+        root_ = root;
+        begin_node = root;
+        last_node = root;
+        if (root->is_nil())
+            return;
+
+        root->set_parent(nil_);
+        root->color_ = Color::black;
+        while (!begin_node->get_left()->is_nil())
+            begin_node = begin_node->get_left();
+        while (!last_node->get_right()->is_nil())
+            last_node = last_node->get_right();
+    }
+
+    /// join and merge for trees whose nodes this allocator cannot free
+    void insert_copies(Tree &&other) {
+        const std::vector<KeyT> keys(other.begin(), other.end());
+        other.clear();
+        insert_batch(keys);
+    }
+
+    /// node over left and right, which now hang below it
+    void link(Node<KeyT> *node, Node<KeyT> *left, Node<KeyT> *right) {
+        node->set_left(left);
+        node->set_right(right);
+        if (!left->is_nil())
+            left->set_parent(node);
+        if (!right->is_nil())
+            right->set_parent(node);
+        update_size(node);
+    }
+
+    // Join-based split and union after Blelloch, Ferizovic and Sun, "Just Join for Parallel
+    // Ordered Sets": the subtrees they pass around are detached, their roots may be red and
+    // their parent links are set by whoever links them next.
+
+    /// root and black height of left, middle and right joined, every key of left less than the
+    /// key of middle and every key of right greater
+    std::pair<Node<KeyT> *, int> join_subtrees(Node<KeyT> *left, int left_height,
+                                               Node<KeyT> *middle, Node<KeyT> *right,
+                                               int right_height) {
+        if (left_height != right_height) {
+            const bool higher_left = left_height > right_height;
+            auto *root = higher_left
+                             ? join_spine<true>(left, left_height, middle, right, right_height)
+                             : join_spine<false>(right, right_height, middle, left, left_height);
+            const int height = std::max(left_height, right_height);
+            if (root->is_red() && root->get_child(higher_left)->is_red()) {
+                root->color_ = Color::black;
+                return {root, height + 1};
+            }
+            return {root, height};
+        }
+
+        link(middle, left, right);
+        if (left->is_black() && right->is_black()) {
+            middle->color_ = Color::red;
+            return {middle, left_height};
+        }
+        middle->color_ = Color::black;
+        return {middle, left_height + 1};
+    }
+
+    /// walks down the Right spine of the higher tree tall (its left spine when !Right) to a
+    /// black node as high as short, hangs middle there and repairs a red-red pair on the way
+    /// back with one rotation; the result is as high as tall
+    template <bool Right>
+    Node<KeyT> *join_spine(Node<KeyT> *tall, int tall_height, Node<KeyT> *middle,
+                           Node<KeyT> *short_tree, int short_height) {
+        if (tall->is_black() && tall_height == short_height) {
+            middle->color_ = Color::red;
+            if constexpr (Right)
+                link(middle, tall, short_tree);
+            else
+                link(middle, short_tree, tall);
+            return middle;
+        }
+
+        auto *inner = Right ? tall->get_right() : tall->get_left();
+        auto *child = join_spine<Right>(inner, tall_height - (tall->is_black() ? 1 : 0), middle,
+                                        short_tree, short_height);
+        if constexpr (Right)
+            tall->set_right(child);
+        else
+            tall->set_left(child);
+        child->set_parent(tall);
+
+        auto *grandchild = Right ? child->get_right() : child->get_left();
+        if (tall->is_black() && child->is_red() && grandchild->is_red()) {
+            grandchild->color_ = Color::black;
+            return rotate_up(tall, child);
+        }
+        update_size(tall);
+        return tall;
+    }
+
+    /// puts child, a child of the detached root node, in its place and returns it
+    Node<KeyT> *rotate_up(Node<KeyT> *node, Node<KeyT> *child) {
+        if (child == node->get_right()) {
+            node->set_right(child->get_left());
+            if (!child->get_left()->is_nil())
+                child->get_left()->set_parent(node);
+            child->set_left(node);
+        } else {
+            node->set_left(child->get_right());
+            if (!child->get_right()->is_nil())
+                child->get_right()->set_parent(node);
+            child->set_right(node);
+        }
+        node->set_parent(child);
+        update_size(node);
+        update_size(child);
+        return child;
+    }
+
+    struct Split_parts {
+        Node<KeyT> *left;
+        int left_height;
+        Node<KeyT> *equal; // the node holding the split key, nil-sentinel when there is none
+        Node<KeyT> *right;
+        int right_height;
+    };
+
+    /// splits the detached subtree of node, height black nodes high, into the keys less than
+    /// key, the node equal to it and the keys greater than it
+    Split_parts split_subtree(Node<KeyT> *node, int height, const KeyT &key) {
+        if (node->is_nil())
+            return {nil_, 0, nil_, nil_, 0};
+
+        auto *left = node->get_left();
+        auto *right = node->get_right();
+        const int child_height = height - (node->is_black() ? 1 : 0);
+
+        if (comp_(key, node->get_key())) {
+            auto parts = split_subtree(left, child_height, key);
+            std::tie(parts.right, parts.right_height) =
+                join_subtrees(parts.right, parts.right_height, node, right, child_height);
+            return parts;
+        }
+        if (comp_(node->get_key(), key)) {
+            auto parts = split_subtree(right, child_height, key);
+            std::tie(parts.left, parts.left_height) =
+                join_subtrees(left, child_height, node, parts.left, parts.left_height);
+            return parts;
+        }
+        return {left, child_height, node, right, child_height};
+    }
+
+    /// root and black height of the union of two detached subtrees; the nodes of b whose keys a
+    /// already holds are freed
+    std::pair<Node<KeyT> *, int> union_subtrees(Node<KeyT> *a, int a_height, Node<KeyT> *b,
+                                                int b_height) {
+        if (a->is_nil())
+            return {b, b_height};
+        if (b->is_nil())
+            return {a, a_height};
+
+        auto parts = split_subtree(b, b_height, a->get_key());
+        if (!parts.equal->is_nil())
+            destroy_node(parts.equal);
+
+        auto *a_left = a->get_left();
+        auto *a_right = a->get_right();
+        const int child_height = a_height - (a->is_black() ? 1 : 0);
+        const auto left = union_subtrees(a_left, child_height, parts.left, parts.left_height);
+        const auto right = union_subtrees(a_right, child_height, parts.right, parts.right_height);
+        return join_subtrees(left.first, left.second, a, right.first, right.second);
+    }
+
+    /// builds the tree of an empty *this from a sorted range in O(n); nodes are laid out in key
+    /// order in one block when the allocator allows it
+    template <std::forward_iterator It> void build_sorted(It first, It last) {
+        assert(root_->is_nil());
+
+        size_type n = 0;
+        for (auto it = first; it != last; ++n)
+            it = skip_equal(it, last);
+        if (n == 0)
+            return;
+
+        const int red_depth = red_depth_of(n);
+
+        node_type *block = nullptr;
+        if constexpr (is_slab_allocator_v<allocator_type>)
+            block = node_traits::allocate(alloc_, n);
+
+        auto node_at = [&](size_type position) -> node_type * {
+            if (block)
+                return block + position;
+            return node_traits::allocate(alloc_, 1);
+        };
+
+        root_ = build_subtree(first, last, 0, n, 0, red_depth, nil_, node_at);
+        find_extremes();
+    }
+
+    /// depth of the deepest level of a balanced tree of n keys, which is colored red since every
+    /// level above it is full; -1 when that level is full too
+    static int red_depth_of(size_type n) noexcept {
+        int full_levels = 0;
+        while ((size_type{2} << full_levels) - 1 <= n)
+            ++full_levels;
+        return ((size_type{1} << full_levels) - 1 == n) ? -1 : full_levels;
+    }
+
+    void find_extremes() noexcept {
+        begin_node = root_;
+        while (!begin_node->get_left()->is_nil())
+            begin_node = begin_node->get_left();
+        last_node = root_;
+        while (!last_node->get_right()->is_nil())
+            last_node = last_node->get_right();
+    }
+
+    /// build_sorted of an empty *this across the pool; repeated keys are dropped first
+    template <std::random_access_iterator It>
+    void build_parallel(It first, It last, Thread_pool &pool) {
+        const auto n = static_cast<size_type>(last - first);
+        if constexpr (is_slab_allocator_v<allocator_type>) {
+            if (pool.size() > 1 && n >= parallel::min_keys_per_task) {
+                if (parallel_is_strictly_sorted(first, last, comp_, pool)) {
+                    build_distinct(first, n, pool);
+                } else {
+                    const auto keys = parallel_unique(first, last, comp_, pool);
+                    build_distinct(keys.begin(), keys.size(), pool);
+                }
+                return;
+            }
+        }
+        build_sorted(first, last);
+    }
+
+    /// the n strictly increasing keys from first into an empty *this: node k of the block holds
+    /// key k, so every thread knows where its nodes and keys are
+    template <std::random_access_iterator It>
+    void build_distinct(It first, size_type n, Thread_pool &pool) {
+        assert(root_->is_nil());
+        if (n == 0)
+            return;
+
+        const int red_depth = red_depth_of(n);
+        node_type *block = node_traits::allocate(alloc_, n);
+        auto node_at = [block](size_type position) -> node_type * { return block + position; };
+
+        int split_depth = 0;
+        while ((size_type{1} << split_depth) < pool.size() * build_tasks_per_thread)
+            ++split_depth;
+
+        std::vector<Build_task> tasks;
+        root_ = build_top(first, 0, n, 0, split_depth, red_depth, nil_, node_at, tasks);
+        pool.run_tasks(tasks.size(), [&](size_type i) {
+            const auto &task = tasks[i];
+            auto it = first + static_cast<std::ptrdiff_t>(task.offset);
+            auto *child = build_subtree(it, it + static_cast<std::ptrdiff_t>(task.n), task.offset,
+                                        task.n, task.depth, red_depth, task.parent, node_at);
+            if (task.right)
+                task.parent->set_right(child);
+            else
+                task.parent->set_left(child);
+        });
+        if constexpr (augmented)
+            fold_top(root_, 0, split_depth);
+        find_extremes();
+    }
+
+    /// the nodes of build_distinct above split_depth; each subtree at split_depth is left as
+    /// the nil-sentinel and recorded as a task that links it in once built
+    template <typename It, typename NodeAt>
+    Node<KeyT> *build_top(It first, size_type offset, size_type n, int depth, int split_depth,
+                          int red_depth, Node<KeyT> *parent, NodeAt &node_at,
+                          std::vector<Build_task> &tasks) {
+        if (n == 0)
+            return nil_;
+
+        const size_type left_n = (n - 1) / 2;
+        auto *node = node_at(offset + left_n);
+        node_traits::construct(alloc_, node, first[static_cast<std::ptrdiff_t>(offset + left_n)],
+                               depth == red_depth ? Color::red : Color::black);
+
+        auto child = [&](size_type child_offset, size_type child_n, bool right) {
+            if (depth + 1 < split_depth)
+                return build_top(first, child_offset, child_n, depth + 1, split_depth, red_depth,
+                                 node, node_at, tasks);
+            if (child_n != 0)
+                tasks.push_back({child_offset, child_n, depth + 1, node, right});
+            return nil_;
+        };
+        node->set_parent(parent);
+        node->set_left(child(offset, left_n, false));
+        node->set_right(child(offset + left_n + 1, n - 1 - left_n, true));
+        node->size_ = n;
+        return node;
+    }
+
+    /// folds the augmentation of the nodes build_top made, once the subtrees below are built
+    void fold_top(Node<KeyT> *node, int depth, int split_depth) {
+        if (node->is_nil() || depth >= split_depth)
+            return;
+        fold_top(node->get_left(), depth + 1, split_depth);
+        fold_top(node->get_right(), depth + 1, split_depth);
+        update_aggregate(node);
+    }
+
+    /// the parallel insert of insert_batch(keys, pool) for sorted keys: piece i of the tree
+    /// takes the keys from the i-th batch quantile up to the next one
+    void insert_pieces(std::span<const KeyT> sorted, Thread_pool &pool) {
+        const size_type m = sorted.size();
+        const auto count = parallel::pieces(m, pool);
+        std::vector<size_type> first(count + 1, m);
+        first[0] = 0;
+        for (size_type i = 1; i < count; ++i)
+            first[i] = static_cast<size_type>(
+                std::lower_bound(sorted.begin(), sorted.end(), sorted[i * m / count], comp_) -
+                sorted.begin());
+
+        // pieces[count - 1 - i] is piece i, split off from the top down
+        std::vector<Tree> pieces;
+        pieces.reserve(count - 1);
+        for (size_type i = count - 1; i > 0; --i)
+            pieces.push_back(split(sorted[first[i]]));
+
+        node_type *block = node_traits::allocate(alloc_, m);
+        std::vector<size_type> used(count);
+        pool.run_tasks(count, [&](size_type i) {
+            Tree &piece = i == 0 ? *this : pieces[count - 1 - i];
+            used[i] = piece.insert_into(sorted.subspan(first[i], first[i + 1] - first[i]),
+                                        block + first[i]);
+        });
+
+        for (size_type i = 0; i < count; ++i)
+            if (first[i] + used[i] != first[i + 1])
+                node_traits::deallocate(alloc_, block + first[i] + used[i],
+                                        first[i + 1] - first[i] - used[i]);
+        for (size_type i = count - 1; i > 0; --i)
+            join(std::move(pieces[i - 1]));
+    }
+
+    /// finger inserts of sorted keys whose new nodes are taken in order from storage; returns
+    /// how many were taken
+    size_type insert_into(std::span<const KeyT> sorted, node_type *storage) {
+        auto *next = storage;
+        Node<KeyT> *finger = root_;
+        for (const auto &key : sorted)
+            finger = insert_from(finger_search(finger, key), key, [&] {
+                         node_traits::construct(alloc_, next, key);
+                         return next++;
+                     }).first;
+        return static_cast<size_type>(next - storage);
+    }
+
+    /// builds the subtree of the n keys starting at in-order position offset
+    template <typename It, typename NodeAt>
+    Node<KeyT> *build_subtree(It &first, It last, size_type offset, size_type n, int depth,
+                              int red_depth, Node<KeyT> *parent, NodeAt &node_at) {
+        if (n == 0)
+            return nil_;
+
+        const size_type left_n = (n - 1) / 2;
+        auto *node = node_at(offset + left_n);
+
+        auto *left =
+            build_subtree(first, last, offset, left_n, depth + 1, red_depth, node, node_at);
+
+        node_traits::construct(alloc_, node, *first,
+                               depth == red_depth ? Color::red : Color::black);
+        first = skip_equal(first, last);
+
+        auto *right = build_subtree(first, last, offset + left_n + 1, n - 1 - left_n, depth + 1,
+                                    red_depth, node, node_at);
+
+        node->set_parent(parent);
+        node->set_left(left);
+        node->set_right(right);
+        node->size_ = n;
+        if constexpr (augmented)
+            update_aggregate(node);
+
+        return node;
+    }
+
+    /// iterator past the run of keys equivalent to *it
+    template <typename It> It skip_equal(It it, It last) const {
+        const auto &key = *it;
+        for (++it; it != last && !comp_(key, *it);)
+            ++it;
+        return it;
+    }
+
+    template <typename... Args> Node<KeyT> *create_node(Args &&...args) {
+        auto *node = node_traits::allocate(alloc_, 1);
+        try {
+            node_traits::construct(alloc_, node, std::forward<Args>(args)...);
+        } catch (...) {
+            node_traits::deallocate(alloc_, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    void destroy_node(Node<KeyT> *base) noexcept {
+        if (!base)
+            return;
+        auto *node = static_cast<node_type *>(base);
+        node_traits::destroy(alloc_, node);
+        node_traits::deallocate(alloc_, node, 1);
+    }
+
+    /// an arena that dies with this tree frees trivially destructible nodes without a walk
+    bool nodes_released_with_allocator() const noexcept {
+        if constexpr (std::is_trivially_destructible_v<KeyT> &&
+                      requires(const allocator_type &a) { a.is_sole_owner(); })
+            return alloc_.is_sole_owner();
+        else
+            return false;
+    }
+
+    /// number of keys not greater than key
+    size_type upper_rank(const KeyT &key) const {
+        size_type rank = 0;
+        for (const Node<KeyT> *current = root_; !current->is_nil();)
+            rank_step<false>(current, rank, key);
+        return rank;
+    }
+
+    /// starts loading the four grandchildren of node while its key is compared; the nil-sentinel
+    /// links to itself, so the loads never leave the tree
+    static void prefetch_grandchildren(const Node<KeyT> *node) noexcept {
+        const auto *left = node->get_left();
+        const auto *right = node->get_right();
+        __builtin_prefetch(left->get_left());
+        __builtin_prefetch(left->get_right());
+        __builtin_prefetch(right->get_left());
+        __builtin_prefetch(right->get_right());
+    }
+
+    /// whether a descent for key turns right at node: past keys less than key (Lower) or not
+    /// greater than key (!Lower)
+    template <bool Lower> bool turns_right(const Node<KeyT> *node, const KeyT &key) const {
+        if constexpr (Lower)
+            return comp_(node->get_key(), key);
+        else
+            return !comp_(key, node->get_key());
+    }
+
+    /// one level of a lower_bound (Lower) or upper_bound descent: the child is picked by
+    /// indexing with the comparison, the candidate is kept or replaced by a conditional move
+    template <bool Lower>
+    void bound_step(const Node<KeyT> *&current, const Node<KeyT> *&candidate,
+                    const KeyT &key) const {
+        prefetch_grandchildren(current);
+        const bool right = turns_right<Lower>(current, key);
+        candidate = right ? candidate : current;
+        current = current->get_child(right);
+    }
+
+    /// one level of a rank (Lower) or upper_rank descent
+    template <bool Lower>
+    void rank_step(const Node<KeyT> *&current, size_type &rank, const KeyT &key) const {
+        prefetch_grandchildren(current);
+        const bool right = turns_right<Lower>(current, key);
+        rank += right ? current->get_left()->size_ + 1 : 0;
+        current = current->get_child(right);
+    }
+
+    /// one group of count_in_range_batch. Lane 2i descends for the lower end of query i, lane
+    /// 2i + 1 for the upper end. A lane touches only the node it stands on: a right turn adds the
+    /// subtree size of the node and the next round subtracts the size of the right child it moved
+    /// to, so left children are never loaded. A lane that reached the nil-sentinel keeps stepping
+    /// on it (size 0, children itself) until the deepest lane of the group is done
+    template <std::size_t Group, std::size_t Extent, typename Count>
+    void count_group(std::span<const std::pair<KeyT, KeyT>, Extent> queries,
+                     std::span<Count, Extent> out) const {
+        constexpr std::size_t lanes = 2 * Group;
+        const Node<KeyT> *node[lanes];
+        size_type rank[lanes];
+        bool came_right[lanes];
+
+        const std::size_t n = queries.size();
+        for (std::size_t j = 0; j < 2 * n; ++j) {
+            node[j] = root_;
+            rank[j] = 0;
+            came_right[j] = false;
+        }
+
+        const auto step = [&]<bool Lower>(std::size_t j, const KeyT &key) {
+            const Node<KeyT> *current = node[j];
+            const size_type size = current->size_;
+            const bool right = turns_right<Lower>(current, key);
+            rank[j] += (right ? size : 0) - (came_right[j] ? size : 0);
+            came_right[j] = right;
+            node[j] = current->get_child(right);
+            __builtin_prefetch(node[j]);
+            return !current->is_nil();
+        };
+
+        for (bool moving = true; moving;) {
+            moving = false;
+            for (std::size_t i = 0; i != n; ++i) {
+                moving |= step.template operator()<true>(2 * i, queries[i].first);
+                moving |= step.template operator()<false>(2 * i + 1, queries[i].second);
+            }
+        }
+
+        for (std::size_t i = 0; i != n; ++i)
+            out[i] = comp_(queries[i].second, queries[i].first)
+                         ? Count{0}
+                         : static_cast<Count>(rank[2 * i + 1] - rank[2 * i]);
+    }
+
     auto get_rank(const Node<KeyT> *node) const {
         if (node->is_nil())
             return root_->size_;
@@ -186,13 +1215,28 @@ template <typename KeyT, typename Compare = std::less<KeyT>> class Tree final {
         return true;
     }
 
+    /// recomputes the size and, with an augmenting policy, the fold of node from its children
     void update_size(Node<KeyT> *node) {
         assert(node);
-        if (node->is_nil()) {
-            node->size_ = 0;
+        if (node->is_nil())
             return;
-        }
         node->size_ = 1 + node->get_left()->size_ + node->get_right()->size_;
+        if constexpr (augmented)
+            update_aggregate(node);
+    }
+
+    void update_aggregate(Node<KeyT> *node) {
+        static_cast<node_type *>(node)->aggregate_ = Augment::combine(
+            Augment::combine(aggregate_of(node->get_left()), Augment::lift(node->get_key())),
+            aggregate_of(node->get_right()));
+    }
+
+    /// fold of the subtree of node, identity() for the nil-sentinel
+    static aggregate_type aggregate_of(const Node<KeyT> *node) {
+        if constexpr (augmented)
+            return static_cast<const node_type *>(node)->aggregate_;
+        else
+            return node->size_;
     }
 
     void destroy_subtree(Node<KeyT> *node) {
@@ -217,13 +1261,138 @@ template <typename KeyT, typename Compare = std::less<KeyT>> class Tree final {
 
                 Node<KeyT> *to_delete = current;
                 current = left_child;
-                delete to_delete;
+                destroy_node(to_delete);
             } else {
                 Node<KeyT> *to_delete = current;
                 current = current->get_right();
-                delete to_delete;
+                destroy_node(to_delete);
+            }
+        }
+    }
+
+    Node<KeyT> *find_node(const KeyT &key) const {
+        auto *current = root_;
+        while (!current->is_nil()) {
+            if (comp_(key, current->get_key()))
+                current = current->get_left();
+            else if (comp_(current->get_key(), key))
+                current = current->get_right();
+            else
+                break;
+        }
+        return current;
+    }
+
+    /// puts v in the place of u in u's parent; the nil-sentinel never gets a parent
+    void transplant(Node<KeyT> *u, Node<KeyT> *v) {
+        auto *parent = u->get_parent();
+        if (parent->is_nil())
+            root_ = v;
+        else if (u == parent->get_left())
+            parent->set_left(v);
+        else
+            parent->set_right(v);
+
+        if (!v->is_nil())
+            v->set_parent(parent);
+    }
+
+    void erase_node(Node<KeyT> *node) {
+        unlink_node(node);
+        destroy_node(node);
+    }
+
+    /// takes node out of the tree without freeing it
+    void unlink_node(Node<KeyT> *node) {
+        assert(node && !node->is_nil());
+
+        if (node == begin_node)
+            begin_node = const_cast<Node<KeyT> *>(std::next(iterator(node)).get());
+        if (node == last_node)
+            last_node = const_cast<Node<KeyT> *>(std::prev(iterator(node)).get());
+
+        // the nil-sentinel keeps itself as parent, so the parent of x is tracked separately
+        Node<KeyT> *x;
+        Node<KeyT> *x_parent;
+        Color removed_color = node->color_;
+
+        if (node->get_left()->is_nil()) {
+            x = node->get_right();
+            x_parent = node->get_parent();
+            transplant(node, x);
+        } else if (node->get_right()->is_nil()) {
+            x = node->get_left();
+            x_parent = node->get_parent();
+            transplant(node, x);
+        } else {
+            auto *successor = node->get_right();
+            while (!successor->get_left()->is_nil())
+                successor = successor->get_left();
+
+            removed_color = successor->color_;
+            x = successor->get_right();
+
+            if (successor->get_parent() == node)
+                x_parent = successor;
+            else {
+                x_parent = successor->get_parent();
+                transplant(successor, x);
+                successor->set_right(node->get_right());
+                successor->get_right()->set_parent(successor);
+            }
+
+            transplant(node, successor);
+            successor->set_left(node->get_left());
+            successor->get_left()->set_parent(successor);
+            successor->color_ = node->color_;
+        }
+
+        for (auto p = x_parent; !p->is_nil(); p = p->get_parent())
+            update_size(p);
+
+        if (removed_color == Color::black)
+            fix_erase(x, x_parent);
+    }
+
+    void fix_erase(Node<KeyT> *x, Node<KeyT> *parent) {
+        while (x != root_ && x->is_black()) {
+            const bool x_is_left = (x == parent->get_left());
+            auto *sibling = x_is_left ? parent->get_right() : parent->get_left();
+
+            if (sibling->is_red()) {
+                sibling->color_ = Color::black;
+                parent->color_ = Color::red;
+                x_is_left ? left_rotate(parent) : right_rotate(parent);
+                sibling = x_is_left ? parent->get_right() : parent->get_left();
+            }
+
+            auto *near = x_is_left ? sibling->get_left() : sibling->get_right();
+            auto *far = x_is_left ? sibling->get_right() : sibling->get_left();
+
+            if (near->is_black() && far->is_black()) {
+                sibling->color_ = Color::red;
+                x = parent;
+                parent = x->get_parent();
+                continue;
             }
+
+            if (far->is_black()) {
+                near->color_ = Color::black;
+                sibling->color_ = Color::red;
+                x_is_left ? right_rotate(sibling) : left_rotate(sibling);
+                sibling = x_is_left ? parent->get_right() : parent->get_left();
+                far = x_is_left ? sibling->get_right() : sibling->get_left();
+            }
+
+            sibling->color_ = parent->color_;
+            parent->color_ = Color::black;
+            far->color_ = Color::black;
+            x_is_left ? left_rotate(parent) : right_rotate(parent);
+            x = root_;
         }
+
+        if (!x->is_nil())
+            x->color_ = Color::black;
     }
 
     void fix_insert(Node<KeyT> *new_node) {
@@ -343,7 +1512,12 @@ template <typename KeyT, typename Compare = std::less<KeyT>> class Tree final {
     void dump_graph_connect_nodes(const Node<KeyT> *node, std::ofstream &gv) const;
 };
 
-template <typename KeyT, typename Compare> void Tree<KeyT, Compare>::dump_graph() const {
+/// Tree keeping the Augment fold of every subtree in its arena-allocated nodes
+template <typename KeyT, typename Augment, typename Compare = std::less<KeyT>>
+using Augmented_tree = Tree<KeyT, Compare, Arena_allocator<KeyT>, Augment>;
+
+template <typename KeyT, typename Compare, typename Allocator, typename Augment>
+void Tree<KeyT, Compare, Allocator, Augment>::dump_graph() const {
     const auto paths = make_dump_paths();
     const std::string gv_file = paths.gv.string();
     const std::string svg_file = paths.svg.string();
@@ -368,8 +1542,9 @@ template <typename KeyT, typename Compare> void Tree<KeyT, Compare>::dump_graph(
     std::system(("dot " + gv_file + " -Tsvg -o " + svg_file).c_str());
 }
 
-template <typename KeyT, typename Compare>
-void Tree<KeyT, Compare>::dump_graph_list_nodes(const Node<KeyT> *node, std::ofstream &gv) const {
+template <typename KeyT, typename Compare, typename Allocator, typename Augment>
+void Tree<KeyT, Compare, Allocator, Augment>::dump_graph_list_nodes(const Node<KeyT> *node,
+                                                                    std::ofstream &gv) const {
     if (!node)
         return;
 
@@ -388,9 +1563,9 @@ void Tree<KeyT, Compare>::dump_graph_list_nodes(const Node<KeyT> *node, std::ofs
         dump_graph_list_nodes(node->get_right(), gv);
 }
 
-template <typename KeyT, typename Compare>
-void Tree<KeyT, Compare>::dump_graph_connect_nodes(const Node<KeyT> *node,
-                                                   std::ofstream &gv) const {
+template <typename KeyT, typename Compare, typename Allocator, typename Augment>
+void Tree<KeyT, Compare, Allocator, Augment>::dump_graph_connect_nodes(const Node<KeyT> *node,
+                                                                       std::ofstream &gv) const {
     if (!node)
         return;
 
@@ -0,0 +1,134 @@
+#ifndef INCLUDE_VERSIONED_TREE_HPP
+#define INCLUDE_VERSIONED_TREE_HPP
+
+#include "arena.hpp"
+#include "persistent_node.hpp"
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace RB_tree {
+
+/// order-statistic red-black tree that keeps every version of itself: insert and erase copy the
+/// search path into a new root and leave the older roots intact, so a query on any past version
+/// costs the same O(log n) as one on the latest. Version 0 is the empty tree and every update
+/// that changes the set adds one; a version costs one root pointer plus the nodes its update
+/// copied, O(log n) of them
+template <typename KeyT, typename Compare = std::less<KeyT>,
+          typename Allocator = Arena_allocator<KeyT>>
+class Versioned_tree final {
+  public:
+    using node_type = Persistent_node<KeyT>;
+    using size_type = std::size_t;
+
+  private:
+    Path_copier<KeyT, Compare, Allocator> copier_;
+    std::vector<const node_type *> roots_{nullptr}; // roots_[v] is version v
+    std::vector<const node_type *> replaced_;       // older versions still use them
+    Compare comp_;
+
+  public:
+    Versioned_tree() = default;
+    explicit Versioned_tree(const Allocator &alloc) : copier_(alloc) {}
+
+    Versioned_tree(const Versioned_tree &) = delete;
+    Versioned_tree &operator=(const Versioned_tree &) = delete;
+
+    ~Versioned_tree() { release(); }
+
+    Compare key_comp() const { return comp_; }
+
+    /// adds key as a new version, false (and no version) when it is already there
+    bool insert(const KeyT &key) {
+        const auto *root = copier_.insert(roots_.back(), key, replaced_);
+        replaced_.clear();
+        return publish(root);
+    }
+
+    /// removes key as a new version; returns the number of removed keys (0 or 1)
+    size_type erase(const KeyT &key) { return publish(copier_.erase(roots_.back(), key)); }
+
+    /// number of the latest version
+    size_type version() const noexcept { return roots_.size() - 1; }
+
+    size_type size() const noexcept { return size(version()); }
+    size_type size(size_type version) const { return node_type::size_of(root(version)); }
+    bool empty() const noexcept { return size() == 0; }
+
+    /// number of keys less than key in version
+    size_type rank(size_type version, const KeyT &key) const {
+        return persistent_rank(root(version), key, comp_);
+    }
+
+    /// number of keys of version in [lo, hi], 0 when hi < lo
+    size_type count_in_range(size_type version, const KeyT &lo, const KeyT &hi) const {
+        if (comp_(hi, lo))
+            return 0;
+        return persistent_upper_rank(root(version), hi, comp_) -
+               persistent_rank(root(version), lo, comp_);
+    }
+
+    size_type count_in_range(const KeyT &lo, const KeyT &hi) const {
+        return count_in_range(version(), lo, hi);
+    }
+
+    /// k-th smallest key of version counting from 0, nullptr when k >= size(version)
+    const KeyT *select(size_type version, size_type k) const {
+        return persistent_select(root(version), k);
+    }
+
+    const KeyT *select(size_type k) const { return select(version(), k); }
+
+    /// nodes held by all versions together
+    size_type node_count() const noexcept { return copier_.live_nodes(); }
+
+    [[nodiscard]] bool check_invariants(size_type version) const {
+        const auto *n = root(version);
+        return !node_type::is_red(n) && persistent_check(n, comp_) != -1;
+    }
+
+  private:
+    const node_type *root(size_type version) const {
+        assert(version < roots_.size());
+        return roots_[version];
+    }
+
+    bool publish(const node_type *root) {
+        if (root == roots_.back())
+            return false;
+        roots_.push_back(root);
+        return true;
+    }
+
+    /// every node belongs to the first version that reached it and stays until the tree goes;
+    /// an arena that dies with the tree frees trivially destructible nodes without a walk
+    void release() noexcept {
+        if constexpr (std::is_trivially_destructible_v<KeyT> &&
+                      requires { copier_.get_allocator().is_sole_owner(); })
+            if (copier_.get_allocator().is_sole_owner())
+                return;
+
+        std::unordered_set<const node_type *> seen;
+        std::vector<const node_type *> stack;
+        for (const auto *root : roots_) {
+            stack.push_back(root);
+            while (!stack.empty()) {
+                const auto *n = stack.back();
+                stack.pop_back();
+                if (!n || !seen.insert(n).second)
+                    continue;
+                stack.push_back(n->get_left());
+                stack.push_back(n->get_right());
+            }
+        }
+        for (const auto *n : seen)
+            copier_.destroy_node(n);
+    }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_VERSIONED_TREE_HPP
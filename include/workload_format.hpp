@@ -0,0 +1,176 @@
+#ifndef INCLUDE_WORKLOAD_FORMAT_HPP
+#define INCLUDE_WORKLOAD_FORMAT_HPP
+
+#include "command_reader.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace RB_tree {
+
+/// Binary command stream: an 8-byte header ("RQWL" and a little-endian u32 version) followed by
+/// records. A record is one LEB128 varint holding (zigzag(arg0 - previous arg0) << 3 | op code),
+/// then for two-argument commands a second varint zigzag(arg1 - arg0).
+namespace workload {
+
+inline constexpr char magic[4] = {'R', 'Q', 'W', 'L'};
+inline constexpr std::uint32_t version = 1;
+inline constexpr std::size_t header_size = 8;
+inline constexpr char ops[] = {'k', 'q', 'd', 's', 'p'};
+
+/// op code of a command letter, -1 for letters the format cannot carry
+inline int op_code(char op) noexcept {
+    for (int i = 0; i < static_cast<int>(sizeof(ops)); ++i)
+        if (ops[i] == op)
+            return i;
+    return -1;
+}
+
+inline std::uint64_t zigzag(std::int64_t v) noexcept {
+    return (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63);
+}
+
+inline std::int64_t unzigzag(std::uint64_t v) noexcept {
+    return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1);
+}
+
+} // namespace workload
+
+/// encodes commands into the binary format on a binary std::ostream
+class Workload_writer final {
+  private:
+    std::ostream &out_;
+    std::int64_t previous_ = 0;
+
+  public:
+    explicit Workload_writer(std::ostream &out) : out_(out) {
+        char header[workload::header_size];
+        std::memcpy(header, workload::magic, sizeof(workload::magic));
+        for (int i = 0; i < 4; ++i)
+            header[4 + i] = static_cast<char>((workload::version >> (8 * i)) & 0xFF);
+        out_.write(header, sizeof(header));
+    }
+
+    /// false when the command has no binary encoding (unknown letter or unreadable arguments)
+    bool write(const Command &cmd) {
+        const int code = workload::op_code(cmd.op);
+        if (code < 0 || !cmd.ok)
+            return false;
+
+        const std::int64_t first = cmd.args[0];
+        put_varint(workload::zigzag(first - previous_) << 3 | static_cast<std::uint64_t>(code));
+        previous_ = first;
+        if (command_arity(cmd.op) == 2)
+            put_varint(workload::zigzag(std::int64_t{cmd.args[1]} - first));
+        return true;
+    }
+
+  private:
+    void put_varint(std::uint64_t v) {
+        char bytes[10];
+        int n = 0;
+        for (; v >= 0x80; v >>= 7)
+            bytes[n++] = static_cast<char>(v | 0x80);
+        bytes[n++] = static_cast<char>(v);
+        out_.write(bytes, n);
+    }
+};
+
+/// replays a binary workload from a mapped file with the same next() interface as
+/// Command_reader
+class Workload_reader final {
+  private:
+    void *map_ = nullptr;
+    std::size_t map_size_ = 0;
+    const unsigned char *cur_ = nullptr;
+    const unsigned char *end_ = nullptr;
+    std::int64_t previous_ = 0;
+    bool valid_ = false;
+    bool corrupt_ = false;
+
+  public:
+    explicit Workload_reader(int fd) {
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) ||
+            static_cast<std::size_t>(st.st_size) < workload::header_size)
+            return;
+
+        map_size_ = static_cast<std::size_t>(st.st_size);
+        map_ = mmap(nullptr, map_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map_ == MAP_FAILED) {
+            map_ = nullptr;
+            return;
+        }
+        madvise(map_, map_size_, MADV_SEQUENTIAL);
+
+        cur_ = static_cast<const unsigned char *>(map_);
+        end_ = cur_ + map_size_;
+        std::uint32_t file_version = 0;
+        for (int i = 0; i < 4; ++i)
+            file_version |= std::uint32_t{cur_[4 + i]} << (8 * i);
+        valid_ = std::memcmp(cur_, workload::magic, sizeof(workload::magic)) == 0 &&
+                 file_version == workload::version;
+        cur_ += workload::header_size;
+    }
+
+    Workload_reader(const Workload_reader &) = delete;
+    Workload_reader &operator=(const Workload_reader &) = delete;
+
+    ~Workload_reader() {
+        if (map_)
+            munmap(map_, map_size_);
+    }
+
+    /// false when the file is missing, not mappable or lacks the header
+    bool valid() const noexcept { return valid_; }
+
+    /// true when reading stopped at a truncated or malformed record
+    bool corrupt() const noexcept { return corrupt_; }
+
+    bool next(Command &cmd) {
+        if (!valid_ || corrupt_ || cur_ == end_)
+            return false;
+
+        std::uint64_t head;
+        if (!get_varint(head) || (head & 7) >= sizeof(workload::ops))
+            return fail();
+
+        cmd.op = workload::ops[head & 7];
+        cmd.ok = true;
+        const std::int64_t first = previous_ + workload::unzigzag(head >> 3);
+        cmd.args[0] = static_cast<int>(first);
+        previous_ = first;
+
+        if (command_arity(cmd.op) == 2) {
+            std::uint64_t delta;
+            if (!get_varint(delta))
+                return fail();
+            cmd.args[1] = static_cast<int>(first + workload::unzigzag(delta));
+        }
+        return true;
+    }
+
+  private:
+    bool fail() noexcept {
+        corrupt_ = true;
+        return false;
+    }
+
+    bool get_varint(std::uint64_t &v) noexcept {
+        v = 0;
+        for (int shift = 0; cur_ != end_ && shift < 64; shift += 7) {
+            const auto byte = *cur_++;
+            v |= std::uint64_t{byte & 0x7Fu} << shift;
+            if (byte < 0x80)
+                return true;
+        }
+        return false;
+    }
+};
+
+} // namespace RB_tree
+
+#endif // INCLUDE_WORKLOAD_FORMAT_HPP
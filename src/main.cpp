@@ -1,71 +1,472 @@
+#include "bplus_tree.hpp"
+#include "command_reader.hpp"
+#include "compact_tree.hpp"
+#include "eytzinger_index.hpp"
+#include "fenwick_set.hpp"
 #include "range_query.hpp"
+#include "result_writer.hpp"
+#include "sharded_tree.hpp"
+#include "snapshot.hpp"
+#include "thread_pool.hpp"
 #include "tree.hpp"
+#include "versioned_tree.hpp"
+#include "workload_format.hpp"
+#include <algorithm>
+#include <charconv>
 #include <chrono>
+#include <concepts>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
 #include <iostream>
+#include <optional>
 #include <set>
+#include <span>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
 
 using namespace RB_tree;
 
-static void driver();
+struct Options {
+    std::size_t threads = 1;
+    bool use_cin = false;
+    bool binary = false;
+    const char *replay = nullptr; // binary workload file to map instead of reading stdin
+    bool freeze = false;          // answer long read-only phases from a frozen Eytzinger_index
+    const char *load = nullptr;   // snapshot the set starts from
+    const char *save = nullptr;   // snapshot written after the last command
+};
 
-int main() { driver(); }
+/// false when the --save snapshot could not be written
+template <typename Reader>
+static bool driver(Reader &reader, Result_writer &out, const Options &options,
+                   const Snapshot_view<int> *start);
 
-static void driver() {
+/// every key a 'k' command of the stream inserts, the universe of the offline engine
+[[maybe_unused]] static std::vector<int> inserted_keys(const std::vector<Command> &commands) {
+    std::vector<int> keys;
+    for (const auto &cmd : commands)
+        if (cmd.op == 'k' && cmd.ok)
+            keys.push_back(cmd.args[0]);
+    return keys;
+}
+
+/// backends that keep their past versions and answer 'v' commands
+template <typename C>
+concept Keeps_versions = requires(const C &c, std::size_t version) {
+    c.count_in_range(version, 0, 0);
+};
+
+/// inserts key as a version of its own; command is the number of the command that made it
+template <typename C>
+static void insert_version(C &tree, int key, std::size_t command,
+                           std::vector<std::size_t> &version_commands) {
+    if (tree.insert(key))
+        version_commands.push_back(command);
+}
+
+/// keys of [lo, hi] in the last version made by command as_of or an earlier one
+template <typename C>
+static long version_query(const C &tree, const std::vector<std::size_t> &version_commands,
+                          std::size_t as_of, int lo, int hi) {
+    const auto version = std::upper_bound(version_commands.begin(), version_commands.end(), as_of) -
+                         version_commands.begin();
+    return range_query(tree, static_cast<std::size_t>(version), lo, hi);
+}
+
+/// inserts a run of keys, across the pool where the backend can
+template <typename C>
+static void insert_keys(C &tree, std::span<const int> keys, Thread_pool &pool) {
+    if constexpr (requires { tree.insert_batch(keys, pool); })
+        tree.insert_batch(keys, pool);
+    else if constexpr (requires { tree.insert_batch(keys); })
+        tree.insert_batch(keys);
+    else
+        for (int key : keys)
+            tree.insert(key);
+}
+
+/// fills an empty tree with the keys of a snapshot, in O(n) where the backend builds from
+/// sorted keys, and across the pool where it builds in parallel
+template <typename C>
+static void restore(C &tree, const Snapshot_view<int> &snapshot, Thread_pool &pool) {
+    if constexpr (requires { C::from_sorted(snapshot.begin(), snapshot.end(), pool); })
+        tree = C::from_sorted(snapshot.begin(), snapshot.end(), pool);
+    else if constexpr (requires { C::from_sorted(snapshot.begin(), snapshot.end()); })
+        tree = C::from_sorted(snapshot.begin(), snapshot.end());
+    else
+        insert_keys(tree, snapshot.keys(), pool);
+}
+
+/// the versions a restored snapshot added count as made by command 0
+template <typename C>
+static void restored_versions(const C &tree, std::vector<std::size_t> &version_commands) {
+    if constexpr (Keeps_versions<C>)
+        version_commands.assign(tree.version(), 0);
+}
+
+/// writes the keys of tree in order as a snapshot file at path; false after reporting an error
+template <typename C> static bool save(const C &tree, const char *path) {
+    const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::perror(path);
+        return false;
+    }
+    bool written;
+    if constexpr (requires { tree.begin(); })
+        written = write_snapshot(fd, tree);
+    else {
+        // the versioned and offline backends have no iterators, only select
+        std::vector<int> keys;
+        keys.reserve(tree.size());
+        for (std::size_t k = 0; k < tree.size(); ++k)
+            keys.push_back(*select_query(tree, k));
+        written = write_snapshot(fd, keys);
+    }
+    if (close(fd) != 0 || !written) {
+        std::perror(path);
+        return false;
+    }
+    return true;
+}
+
+/// copies tree into frozen when it can be walked in order; the offline engine cannot
+template <typename C>
+static void freeze(std::optional<Eytzinger_index<int>> &frozen, const C &tree) {
+    if constexpr (std::constructible_from<Eytzinger_index<int>, const C &>)
+        frozen.emplace(tree);
+}
+
+/// parses "--threads N" (N = 0 meaning every core, and the shard count of the sharded backend),
+/// "--cin" (read through std::cin), "--binary" (results as little-endian 64-bit integers),
+/// "--replay FILE" (binary workload), "--freeze" (frozen index for read-only phases),
+/// "--load FILE" (start from a snapshot) and "--save FILE" (snapshot of the final set)
+static bool parse_options(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--cin") == 0) {
+            options.use_cin = true;
+            continue;
+        }
+        if (std::strcmp(argv[i], "--binary") == 0) {
+            options.binary = true;
+            continue;
+        }
+        if (std::strcmp(argv[i], "--freeze") == 0) {
+            options.freeze = true;
+            continue;
+        }
+        if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            options.replay = argv[++i];
+            continue;
+        }
+        if (std::strcmp(argv[i], "--load") == 0 && i + 1 < argc) {
+            options.load = argv[++i];
+            continue;
+        }
+        if (std::strcmp(argv[i], "--save") == 0 && i + 1 < argc) {
+            options.save = argv[++i];
+            continue;
+        }
+        if (std::strcmp(argv[i], "--threads") != 0 || ++i == argc)
+            return false;
+
+        const char *last = argv[i] + std::strlen(argv[i]);
+        auto [end, ec] = std::from_chars(argv[i], last, options.threads);
+        if (ec != std::errc{} || end != last)
+            return false;
+    }
+
+    if (options.threads == 0)
+        options.threads = std::max(1u, std::thread::hardware_concurrency());
+    return true;
+}
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--threads N] [--cin] [--binary] [--replay FILE] [--freeze] [--load FILE]"
+                     " [--save FILE]\n";
+        return 1;
+    }
+
+    std::optional<Snapshot_view<int>> start;
+    if (options.load) {
+        const int fd = open(options.load, O_RDONLY);
+        if (fd < 0) {
+            std::perror(options.load);
+            return 1;
+        }
+        start.emplace(fd);
+        close(fd);
+        if (!start->valid() || !start->verify()) {
+            std::cerr << "Error: " << options.load << " is not an intact snapshot.\n";
+            return 1;
+        }
+    }
+    const Snapshot_view<int> *snapshot = start ? &*start : nullptr;
+    bool saved = true;
+
+    Result_writer out(STDOUT_FILENO,
+                      options.binary ? Result_writer::Mode::binary : Result_writer::Mode::text);
+    if (options.replay) {
+        const int fd = open(options.replay, O_RDONLY);
+        if (fd < 0) {
+            std::perror(options.replay);
+            return 1;
+        }
+        Workload_reader reader(fd);
+        close(fd);
+        if (!reader.valid()) {
+            std::cerr << "Error: " << options.replay << " is not a binary workload.\n";
+            return 1;
+        }
+        saved = driver(reader, out, options, snapshot);
+        if (reader.corrupt()) {
+            std::cerr << "Error: " << options.replay << " ends with a truncated record.\n";
+            return 1;
+        }
+    } else if (options.use_cin) {
+        Stream_reader reader(std::cin);
+        saved = driver(reader, out, options, snapshot);
+    } else {
+        Command_reader reader;
+        saved = driver(reader, out, options, snapshot);
+    }
+    return saved && out.good() ? 0 : 1;
+}
+
+template <typename Reader>
+static bool driver(Reader &reader, Result_writer &out, const Options &options,
+                   const Snapshot_view<int> *start) {
 
 #ifdef STD_SET_RUN
     std::set<int> tree;
-#else
+#elif defined(COMPACT_TREE_RUN)
+    Compact_tree<int> tree;
+#elif defined(BPLUS_TREE_RUN)
+    BPlus_tree<int> tree;
+#elif defined(VERSIONED_TREE_RUN)
+    Versioned_tree<int> tree;
+#elif defined(SHARDED_TREE_RUN)
+    // one shard, and one ingest worker, per query thread
+    Sharded_tree<int> tree(options.threads);
+#elif !defined(FENWICK_RUN)
     Tree<int> tree;
 #endif
 
-    char query;
-
 #ifdef TIMING_RUN
     double msf = 0;
+    double erase_ms = 0;
     using clock = std::chrono::steady_clock;
 #endif
 
-    while (std::cin >> query) {
-        int key;
-        int fst, snd;
+#ifdef FENWICK_RUN
+    // offline: the whole stream is read first, so the set can be built over every key it will
+    // ever hold and then replayed command by command
+#ifdef TIMING_RUN
+    auto build_start = clock::now();
+#endif
+    std::vector<Command> commands;
+    for (Command cmd; reader.next(cmd);)
+        commands.push_back(cmd);
+    auto universe = inserted_keys(commands);
+    if (start)
+        universe.insert(universe.end(), start->begin(), start->end());
+    Fenwick_set<int> tree(std::move(universe));
+    Command_list_reader input(commands);
+#ifdef TIMING_RUN
+    const double build_ms =
+        std::chrono::duration<double, std::milli>(clock::now() - build_start).count();
+#endif
+#else
+    Reader &input = reader;
+#endif
+
+    // a run of 'q' commands only reads the tree, so it is answered in one go across the pool
+    Thread_pool pool(options.threads);
+    constexpr std::size_t max_query_run = 1 << 16;
+    std::vector<std::pair<int, int>> pending_queries;
+    std::vector<long> results;
+
+    // with --freeze, once the queries since the last update outnumber size / freeze_ratio, the
+    // tree is copied into an Eytzinger_index that answers them until the next update
+    constexpr std::size_t freeze_ratio = 32;
+    std::optional<Eytzinger_index<int>> frozen;
+    std::size_t read_only_queries = 0;
+    auto thaw = [&] {
+        frozen.reset();
+        read_only_queries = 0;
+    };
+
+    auto flush_queries = [&] {
+        if (pending_queries.empty())
+            return;
+        results.resize(pending_queries.size());
+#ifdef TIMING_RUN
+        auto t0 = clock::now();
+#endif
+        const std::span<const std::pair<int, int>> queries(pending_queries);
+        read_only_queries += queries.size();
+        if (options.freeze && !frozen && read_only_queries * freeze_ratio >= tree.size())
+            freeze(frozen, tree);
+        if (frozen)
+            range_query_run(*frozen, queries, std::span<long>(results), pool);
+        else
+            range_query_run(tree, queries, std::span<long>(results), pool);
+#ifdef TIMING_RUN
+        msf += std::chrono::duration<double, std::milli>(clock::now() - t0).count();
+#else
+        out.put(std::span<const long>(results));
+#endif
+        pending_queries.clear();
+    };
+
+    // a run of 'k' commands is inserted as one batch right before the next command that reads
+    std::vector<int> pending_keys;
+    auto flush_keys = [&] {
+        if (pending_keys.empty())
+            return;
+        flush_queries();
+        thaw();
+        insert_keys(tree, pending_keys, pool);
+        pending_keys.clear();
+    };
+
+    // with a versioned backend version_commands[v - 1] is the number of the command that made
+    // version v, so 'v N L R' reads the last version made by command N or an earlier one
+    std::size_t command_number = 0;
+    [[maybe_unused]] std::vector<std::size_t> version_commands;
+
+    if (start) {
+#ifdef TIMING_RUN
+        auto t0 = clock::now();
+#endif
+        restore(tree, *start, pool);
+        restored_versions(tree, version_commands);
+#ifdef TIMING_RUN
+        std::cout << "Restore time: "
+                  << std::chrono::duration<double, std::milli>(clock::now() - t0).count()
+                  << " ms\n";
+#endif
+    }
+
+    Command cmd;
+    while (input.next(cmd)) {
+        ++command_number;
+        if (!cmd.ok) {
+            static constexpr const char *expected[] = {"", "integer", "two integers",
+                                                       "three integers"};
+            std::cerr << "Error: invalid input for '" << cmd.op << "' command. Expected "
+                      << expected[command_arity(cmd.op)] << ".\n";
+            continue;
+        }
+        const int key = cmd.args[0];
+        const int fst = cmd.args[0];
+        const int snd = cmd.args[1];
 
-        switch (query) {
+        switch (cmd.op) {
         case 'k':
-            if (std::cin >> key) {
-                tree.insert(key);
-            } else {
-                std::cerr << "Error: invalid input for 'k' command. Expected integer.\n";
-                std::cin.clear();
-                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            }
+            if constexpr (Keeps_versions<decltype(tree)>) {
+                // every insert is a version of its own, so it cannot wait for a batch
+                flush_queries();
+                insert_version(tree, key, command_number, version_commands);
+            } else
+                pending_keys.push_back(key);
             break;
+        case 'd': {
+            flush_queries();
+            flush_keys();
+            thaw();
+#ifdef TIMING_RUN
+            auto t0 = clock::now();
+#endif
+            [[maybe_unused]] const auto erased = tree.erase(key);
+#ifdef TIMING_RUN
+            erase_ms += std::chrono::duration<double, std::milli>(clock::now() - t0).count();
+#endif
+            if constexpr (Keeps_versions<decltype(tree)>)
+                if (erased)
+                    version_commands.push_back(command_number);
+            break;
+        }
         case 'q':
-            if (std::cin >> fst >> snd) {
-                std::size_t result = 0;
+            flush_keys();
+            pending_queries.emplace_back(fst, snd);
+            if (pending_queries.size() == max_query_run)
+                flush_queries();
+            break;
+        case 's': {
+            flush_queries();
+            flush_keys();
+            if (key < 1 || static_cast<std::size_t>(key) > tree.size()) {
+                std::cerr << "Error: 's' expects a position in [1, " << tree.size() << "].\n";
+                break;
+            }
+            [[maybe_unused]] auto it = select_query(tree, static_cast<std::size_t>(key - 1));
+#ifndef TIMING_RUN
+            out.put(*it);
+#endif
+            break;
+        }
+        case 'p': {
+            flush_queries();
+            flush_keys();
+            if (fst < 0 || fst > snd || snd > 100 || tree.size() == 0) {
+                std::cerr << "Error: 'p' expects 0 <= lo <= hi <= 100 and a non-empty set.\n";
+                break;
+            }
+            [[maybe_unused]] auto [first, last] = percentile_range(tree, fst, snd);
+#ifndef TIMING_RUN
+            out.put(*first);
+            out.put(*last);
+#endif
+            break;
+        }
+        case 'v': {
+            flush_queries();
+            flush_keys();
+            if constexpr (Keeps_versions<decltype(tree)>) {
+                const int as_of = cmd.args[0];
+                if (as_of < 0) {
+                    std::cerr << "Error: 'v' expects a command number N >= 0.\n";
+                    break;
+                }
 #ifdef TIMING_RUN
                 auto t0 = clock::now();
 #endif
-                result = range_query(tree, fst, snd);
+                [[maybe_unused]] const long count =
+                    version_query(tree, version_commands, static_cast<std::size_t>(as_of),
+                                  cmd.args[1], cmd.args[2]);
 #ifdef TIMING_RUN
-                asm volatile("" : : "r"(result));
-                auto t1 = clock::now();
-                msf += std::chrono::duration<double, std::milli>(t1 - t0).count();
+                msf += std::chrono::duration<double, std::milli>(clock::now() - t0).count();
 #else
-                std::cout << result << ' ';
+                out.put(count);
 #endif
-            } else {
-                std::cerr << "Error: invalid input for 'q' command. Expected two integers.\n";
-                std::cin.clear();
-                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            }
+            } else
+                std::cerr << "Error: 'v' needs a backend that keeps versions.\n";
             break;
+        }
         default:
+            flush_queries();
             std::cerr << "unknown command\n";
         }
     }
+    flush_queries();
+    flush_keys();
+    const bool saved = !options.save || save(tree, options.save);
 
 #ifdef TIMING_RUN
     std::cout << "Total time: " << msf << " ms\n";
+    if (erase_ms > 0)
+        std::cout << "Erase time: " << erase_ms << " ms\n";
+#ifdef FENWICK_RUN
+    std::cout << "Offline build time: " << build_ms << " ms\n";
+#endif
+    std::cout.flush();
 #endif
-    std::cout << std::endl;
+    out.finish();
+    return saved;
 }
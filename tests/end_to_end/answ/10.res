@@ -0,0 +1 @@
+3 3 0 3 1 1 1 0 4 2 2 5 8 1 10 9 21 20 14 3 0 10 4 14 42 16 44 9 36 22 16 45 3 13 6 38 18 38 35 16 7 52 5 7 7 0 48 29 41 72 1 58 14 36 40 36 55 17 17 37 37 33 24 10 1 14 17 36 63 54 13 39 101 24 19 83 22 82 11 9 23 17 84 16 24 4 2 1 90 8 93 23 50 54 91 38 4 60 114 30 46 13 22 115 2 22 1 13 58 153 70 88 82 19 9 56 159 115 9 79 103 31 11 72 30 91 18 46 117 135 94 165 78 69 65 111 64 65 105 123 37 103 19 44 4 91 171 32 64 1 183 9 194 8 59 10 31 30 12 72 64 151 65 47 119 122 69 18 37 93 68 172 15 48 112 42 43 19 43 37 229 178 12 18 204 30 32 42 248 37 107 133 12 139 61 3 52 117 83 91 154 36 166 38 37 218 105 137 152 57 133 124 164 74 45 43 42 28 93 61 79 207 32 100 82 23 153 219 83 16 19 169 89 191 107 1 118 322 34 90 99 137 56 41 99 13 41 175 115 42 181 109 332 55 109 197 255 269 260 95 179 131 237 43 65 383 30 34 302 242 69 26 48 290 9 275 87 8 153 6 53 185 97 30 26 392 112 313 143 194 11 70 106 374 92 25 122 84 221 30 151 61 111 289 86 81 73 35 258 0 122 124 72 290 268 231 279 141 189 104 248 94 209 83 152 9 283 27 163 43 180 264 166 349 54 124 119 259 131 23 152 271 79 286 132 27 138 40 72 67 247 150 444 58 41 432 47 369 258 94 385 136 112 254 109 94 132 148 70 104 340 74 479 23 93 69 130 138 214 111 539 239 342 14 328 175 94 186 363 151 4 274 86 116 358 113 40 3 80 209 563 126 102 192 73 199 134 105 77 281 41 60 581 187 186 271 163 546 341 319 571 60 185 336 169 56 407 276 405 472 492 24 461 106 107 458 125 199 29 94 121 23 171 425 231 440 15 114 369 350 180 305 313 345 339 106 290 142 284 522 339 112 24 15 71 248 86 234 208 584 640 156 163 415 476 95 125 231 640 119 183 532 178 182 138 334 310 347 164 278 333 18 600 117 63 30 16 165 368 78 155 274 177 212 254 6 207 42 30 192 411 56 387 244 427 400 191 240 728 293 227 433 125 146 395 68 727 374 372 78 263 540 204 419 193 556 232 248 189 235 571 302 312 90 24 128 152 30 95 118 216 344 140 161 40 153 422 39 333 555 56 678 151 92 598 339 280 110 190 84 703 581 287 341 437 80 738 350 283 72 168 45 386 54 47 492 29 445 15 94 250 235 335 83 69 121 284 648 197 311 360 294 360 54 202 792 83 195 381 193 38 676 262 144 334 188 288 35 610 44 203 546 225 52 61 93 205 154 274 604 128 305 295 468 183 558 661 613 256 104 409 290 5 474 406 120 509 528 377 98 134 562 122 972 510 285 253 40 503 482 160 398 527 518 303 414 519 144 30 341 30 9 192 457 271 514 365 25 283 334 98 0 797 23 479 279 335 701 321 827 384 516 29 519 347 130 270 951 241 2 578 440 698 554 577 219 341 398 179 583 211 824 436 838 164 676 230 263 219 136 448 658 47 608 121 37 620 240 340 40 318 89 934 52 480 69 391 601 470 205 701 188 984 155 450 324 123 529 146 252 228 578 32 369 683 619 182 938 591 57 706 587 52 68 228 221 878 393 514 391 200 329 654 540 310 90 34 548 564 312 75 538 819 59 177 1134 497 913 629 443 169 655 677 891 107 238 250 74 694 82 401 117 407 50 79 207 363 284 247 53 112 327 441 83 672 433 80 279 367 593 179 366 1093 501 315 622 171 537 77 627 354 650 982 470 102 1092 712 798 365 1081 125 784 544 456 115 886 855 67 60 292 431 278 217 671 401 61 1100 846 573 376 227 487 263 369 1198 186 381 738 118 1301 854 137 344 289 780 821 456 473 896 594 449 262 337 52 419 199 939 1264 937 417 411 1179 795 508 37 69 224 741 99 269 720 374 127 166 652 141 160 63 807 722 788 482 246 1299 424 733 302 553 697 607 1185 86 436 562 337 33 481 513 188 14 35 546 356 551 72 785 186 572 152 145 705 1324 599 1154 30 146 1088 498 426 30 55 475 817 242 152 592 1062 684 1154 174 298 299 792 233 1231 1169 930 332 163 88 239 333 394 413 765 520 1118 281 608 3 479 258 64 42 88 218 204 794 228 318 665 217 1239 175 643 531 472 1018 92 751 898 352 189 188 146 388 602 521 431 384 39 196 40 221 53 72 782 615 483 97 515 363 658 1147 979 87 43 276 1096 663 1165 1343 222 474 345 61 495 505 1419 185 135 464 625 531 204 442 89 1104 81 175 4 294 169 821 182 217 618 972 894 816 4 251 1391 999 485 787 256 432 698 874 1025 102 1172 585 639 686 679 868 550 611 1103 916 366 604 173 426 778 283 324 427 314 243 351 50 207 877 246 301 650 766 1263 1123 793 1482 80 837 445 1172 121 47 806 1298 279 384 1247 1424 344 43 528 1312 875 216 1209 188 60 656 101 230 606 1475 485 302 352 1021 134 639 79 819 487 222 496 1349 1226 82 745 837 171 665 508 354 296 630 973 352 1382 445 513 120 48 879 709 551 394 425 1298 367 808 935 926 1280 261 287 566 836 950 147 1020 469 897 206 1504 29 731 601 153 8 542 949 342 968 337 982 370 1039 1243 123 807 7 242 19 557 109 108 609 174 747 304 948 938 820 384 608 336 1480 895 261 1081 608 106 809 313 630 462 30 366 700 897 43 177 1366 399 543 558 1158 629 842 931 614 1648 362 560 711 1069 814 748 531 44 56 522 1873 932 1109 338 640 693 705 1628 1132 1310 187 88 328 830 1310 1283 1255 1400 234 535 302 255 905 1204 808 1029 349 122 1243 611 241 231 240 642 282 117 580 135 485 802 1262 942 65 532 850 141 1293 532 544 884 1068 789 1332 129 177 1319 385 219 149 875 256 955 692 488 336 857 1496 1341 241 211 848 867 1564 22 248 1500 1324 1242 589 214 1654 1464 1748 40 1025 445 415 1050 1786 250 649 62 823 566 579 178 1255 688 234 152 67 482 1541 958 1362 1552 1401 715 7 281 214 1445 274 1094 163 247 843 519 390 183 339 232 1789 406 154 420 891 1287 597 421 124 957 189 1017 489 902 1120 360 1037 118 1384 168 208 129 269 628 228 1143 10 1249 1074 346 403 797 162 271 370 1409 878 323 356 1605 407 80 858 1583 865 605 850 1237 424 860 373 219 2111 77 539 764 1045 12 724 1400 627 145 348 46 260 390 130 37 1193 74 1682 922 121 26 1010 275 599 1671 353 391 69 641 406 1323 99 2146 354 1389 79 1008 555 1160 44 607 719 46 478 156 5 1572 839 274 8 565 428 1039 142 1306 757 565 1361 1147 275 227 1010 149 158 1114 1018 894 1322 188 206 503 335 1370 642 1771 1874 181 376 521 477 796 441 637 55 991 911 201 177 42 1956 1916 128 350 571 1148 1655 1360 257 1687 1810 5 677 299 59 433 1161 941 2080 687 316 1827 935 587 1256 971 1809 309 490 20 465 112 1746 1352 205 108 492 966 1308 611 1373 673 1714 134 182 36 335 595 539 1064 1030 35 1357 745 886 1883 2223 1807 630 617 678 1219 797 617 1380 1017 1704 754 799 66 102 1843 1516 2030 335 849 1926 1937 795 124 1115 352 68 1787 17 689 1931 1104 726 220 617 546 366 136 436 578 1380 1391 39 1137 1791 1544 1966 827 868 357 1164 1101 1121 237 114 227 2014 408 1249 993 623 271 564 947 308 747 483 18 607 228 352 1486 818 448 957 2439 888 811 282 205 1642 461 1064 516 964 1008 365 473 1318 1013 1568 1203 1848 1002 1334 318 2013 1926 1105 244 204 1163 1101 1480 770 2108 830 2123 102 1043 505 991 1658 662 1333 2097 1116 1007 830 24 2068 489 915 1232 397 1028 309 32 448 519 236 405 2008 249 101 704 1129 178 1212 134 1009 1087 484 535 636 404 902 478 120 2175 581 262 623 429 52 2006 1501 415 1810 270 973 1315 806 1262 804 320 787 2204 182 193 783 2103 331 1587 2016 1156 471 1349 2182 145 551 869 473 172 48 972 900 521 1197 1475 188 82 1103 2026 1177 55 1560 1104 934 1683 85 391 586 280 63 603 1363 8 160 858 991 1131 13 1042 1199 442 1652 161 232 644 1794 647 414 1524 1339 487 816 242 658 284 518 1616 1736 1483 870 674 1783 2083 1223 16 1248 898 1147 826 2428 677 1054 2720 2227 1843 892 253 57 532 835 1250 1313 515 385 183 1343 2036 653 1005 1147 557 476 502 1089 1400 1231 2584 409 480 954 2108 1613 1621 312 720 121 559 188 16 1039 182 659 1120 1238 118 837 635 1243 184 684 251 686 2551 1697 1588 2426 724 713 1726 1732 219 190 771 1729 1855 1091 1018 1047 773 745 1347 2372 1778 457 1282 1462 822 1730 244 1547 1405 1727 269 2737 2190 2157 676 1409 1880 259 569 603 773 50 521 1165 265 1250 1630 740 433 1266 2302 673 1234 1730 1468 208 1105 1776 99 1660 127 690 265 479 649 1633 1097 2540 484 6 723 1089 717 1024 105 109 313 2348 870 393 187 2309 374 200 732 30 2015 970 479 2076 277 617 671 1041 216 892 283 689 287 1410 160 384 794 359 235 134 1966 1385 459 310 17 1163 875 1859 638 39 0 851 881 696 1180 348 1782 146 593 709 851 181 734 1497 1077 2127 1808 18 
@@ -0,0 +1 @@
+0 120567 590397 41585 231814 864853 63762 0 644704 740612 25 21 18 22 8 405809 12 29 5 34 30 413633 896731 7 10 120567 18 6 54 6 977618 989123 19 8 700119 930937 0 8 9 760599 829251 29 160394 58 25 8 705107 3 58 22 45 16 9 590397 22 8 15 35 82 23 96 69 55 310760 844306 31 46 91 24 4 804120 26 494134 828626 844306 42 18 150847 995239 10 63644 122 19 26 2 84 484091 193110 413633 93 20 89 62 36 771878 941335 75 6 34 21 56 13 161 11 374807 35 98 772428 67 37 28 82 37 2 129 2 69 13 89 39 670006 867976 61 136 319603 100 147 25 144 48 7 18 57 113 961550 982613 217 234431 694681 84 39 60 411312 621787 66 100719 791087 30 130 100 44 38 79 963644 83 18 353671 523612 10 897524 930937 84 24 146 163 976465 83 163 13 219 96 413633 814676 201 90 219667 78 648997 94 0 143 59 33 49 666908 50 6 95 35 738244 976465 191 828490 941335 69 61 143 49 86 257 139 244 61 432853 739167 120 83 83 249 147 39 160394 166 148 565450 3 69 25 4 196 129 81 36 105 107 320 447393 5 187 46 698813 846680 856984 445186 856984 209 33 938449 142 48992 278 3 379918 468213 151 89 315 103 129 22216 234431 380188 483800 456224 8700 84 70 0 94 917584 995239 50 155 12 117 253 55 615376 864853 936326 105 79 246 93 117 226 40 372274 320 90 29 126 143 78 984685 984685 180 320 9 736324 777142 135 8 44 462618 836060 175 323 0 64434 573013 287 91 278155 164 189 32 885118 907724 594926 814676 116 199 198 786463 178 306792 194 926092 585543 161 753091 801308 54 94 235464 240 390 42095 99 187 31 77 353671 25 520039 731484 738244 10 405809 56 85 8700 936326 206 3 405 328 42 100719 275616 185 146 325001 936326 615376 999064 52 242 2 302 266 290006 124 211 23 65 282 92 32 449248 13 549 10 267 381 666908 121542 177908 0 209 322 999064 999064 912663 912663 33 201680 194 291 9 410505 442744 312 498 371 423942 523612 96 441 237 479 663098 371 892728 977618 202232 58 99 129 312 558 71 180 236 720424 568 392 73 163 686208 966323 310 276606 602923 96 540304 64434 349 7 45 856984 935164 119 284 310 318 362 178 178 268 183 602 5 939404 939404 203 790573 181 376 307 148237 481903 392 211 20 323 698813 270931 353671 210 290 124 320263 687282 397076 196 34 402 259 224 232 248 15 437 866869 186 44 625 443 565 41 133 88 700119 12 48 365 959855 42 14 594926 766877 8 225 563 70014 13088 893715 281 270 423942 802984 112 59 81 705107 837459 109 103 200 693 102200 409925 987438 594 297 566 399 415244 171 82 507343 191253 603028 275 812705 812705 317 81 554 274 395 949054 223 51 668 940037 175 621756 837042 72 388218 479 36 192381 192381 98 61 71 317 719783 987867 245 191 905304 961121 618 817075 987867 357 502 475 355 576 635 885118 979801 58 129 23 35 313 139 182 432547 592328 725739 801308 120 63486 161143 284 111 183 308 961121 999064 77 559 6 402 231 52 683811 802942 152 67 594926 772428 560 815422 968971 7 772376 650868 83 516 453 61 102 392 159 630 110 722273 450 796838 796838 571 921605 160 75 20 696 241 347 184 36 96402 683377 8 428 683 266 39 404 312 365 358 428600 117 55 390085 138 427 281 475014 672098 411 647755 828626 118179 938449 303 72 337 241 481 42963 191 374 5 430 121 332 472 517 323 345319 580 269871 392 28 533009 586979 312 581 263 656729 565510 163 325 503 893715 959855 851 353675 979439 313 230617 658471 38 291331 746702 341726 274 245 491 901678 938449 159 82401 506335 491 693 230 662 844306 999064 46 9 938114 954447 326 318 507343 242 175 334 480 156 580 748515 999064 143 222693 585214 389 361 544 29 459 489434 374 827170 958609 501 938449 958609 626 852903 509 433 152 823 248 539 265 329 491005 291 64434 432853 38 99 235 342 255 229 331204 795504 264 217216 827399 195387 733051 5 873 93180 161973 208 428 432 108 15 361 824 177 400 29 256 257 958609 979279 106822 36 215 724 558 244516 776680 56 40 402 648 167289 68 903 82 884 167 504 308562 76 282 116 268 48 755 303 388 527 75 696737 735330 904 280 482 327 278502 312453 199 485 480 632 244516 685182 270 410 252 174 117960 807353 19315 35502 380 517 248 368 318 430 28 539 559 141 1083 304 203 133 654 871491 395 447 695 439 174 709 434 264 489434 596466 864 505 1016 427 234 394 1111 611 228 586979 727 284 496863 850413 634 80 426 403 631 529 761 759933 354 568 593 403 526 147 968 798 69 8 940037 972825 111 988189 988189 529757 984 910 363110 738060 875990 179 0 246 4167 928 586979 177 999064 999064 998 93 83 193 553 376 1042 155 29 1023 78 609 189 794 349 148 754105 838372 337014 216 627 170 628891 751338 594926 852903 1022 983210 228 374 491450 300 204 51 541 258 901953 638 446 620 699 403 476 936326 907 389 784 182570 506342 350 939404 988010 637 582 935 528829 777887 606616 777142 450 604 777887 864853 237 418619 842356 1118 296 397 138 143 917043 917043 81 144 938449 958609 171 937 518 159 406 423982 853766 541 22 168 202 218 362 61 599 837042 328 218 1458 358 34625 456 439 474 787212 1281 193254 853918 842348 842348 559 360 444 107993 131996 550959 853918 1168 351 1007 275 116571 176 249 459 768 711 179556 651 692052 32 35 1125 378 446 282 672118 928168 62 605 224303 1049 1217 320263 719 96402 1110 830 30 280 70 270 976 767 212 958 893 569013 871 536 504540 852903 1081 297 324 393419 844 750395 888399 216 410 420360 927565 1382 463 732023 742788 1110 158 290 383 927 193110 193110 123 484091 131 329 328 160 869600 814547 869600 278728 804 681366 837779 264 613 1029 253 787524 765 814445 804728 71 516 417 694 219667 1365 102200 85912 724959 1 498 357 719275 71 549 415 737 935 903 366458 762881 584 969 236 1025 347 642 755 851273 961121 344 358068 785221 637 628 1399 662659 916893 131 345216 656297 747 465 624 325 240 823 99 842115 869526 703775 806472 747 258 43 45 198 431 359708 359708 1001 126 80781 107 15 1227 200 200 17 194721 547 315 754 900 963676 229 375609 323 324 16 503 1114 308562 809153 853918 51576 452550 564298 547 323 462618 75 547 150486 500140 1137 1404 675 2171 699 536 1164 564 1330 406 293 278543 608 345 512 803 130 816 335 1017 340 1194 428 686 907724 984260 366 695 38 598937 853889 786 167279 239269 472 117 480422 31 310282 832064 619 147 771 535 300 523540 746702 760 1045 47 1322 1059 1713 724959 983210 715 487 186985 388083 244 111 685182 983210 1212 858 14 1222 812037 1117 124 597 202232 424 403 929192 961121 1414 830529 999668 590755 853889 1435 730 828 725 555419 819940 304 1164 688 1088 410 29 611 502 81867 572 604 798269 830382 1111 97 633 293 176 115 51 148 221258 207 910 629 878 830 876467 961121 42 786 277 533 724 183 309082 983210 351107 330 605 684 77 134 367 1299 921 358091 72 863 57647 656 367 1023 636950 939771 1163 823 608 429 56 1516 504540 1309 168 1197 806304 990065 500 232 831 83 1266 664 273084 772376 949 890323 555 176 488 262 38 629717 700929 1032 575 924 1382 982 64 315 612 939771 990065 1425 166271 499 486 662659 135 217474 557908 575 53906 743 1055 442 495 373 408 690270 815422 584 514 115 492 1340 579 500282 713890 825 556 455 554 541 44 1188 575782 673281 461 488 1300 194 553 333 228 774 318606 1145 1922 1065 496 214 1536 557 291 485 15653 246 1074 1217 1227 442 388230 683444 39 167 688 792 1166 33998 919 530812 798269 51576 650868 50 141 808478 15 396 1572 624 1473 899 870455 421 770 334 427829 459 243 823 359 164524 691474 632 322 703230 929192 637142 887198 650178 722698 1047 1031 43 226986 381239 625 1116 414 904 738 683811 1913 298 1489 173949 648635 557 113 656 1176 490930 983210 41 153121 1077 810 110081 156192 574 564 516 839 983210 999668 522 384 29 217387 464171 639 1784 232 744 509685 671924 87 508186 1173 324 198 950 491094 972825 167351 465 954 451 581 846 870 216 230 103 10 508 127 146 1958 616 1394 1268 483673 972698 1291 1208 13 521 1018 917584 1285 554 306 246 1657 122 306 63 617269 999668 949 222 278 314071 37 48488 372996 683661 1740 28015 340599 320 196058 875788 420 307 816868 940005 1709 61655 354452 149157 753091 272 531673 539068 960 845 1098 791 600952 210 1181 239 1039 651327 886563 407 1107 493 1925 666 157691 664316 1186 605 903188 971 1410 489 659338 787 654 61729 428322 35502 876467 1523 114 1568 80 734405 869526 187 54 181 1594 24 1632 259 555273 948296 67 765 880 792 1729 255146 982475 564 521 109496 386 1143 875 1745 826 167289 429337 1361 477 1488 683 1024 294 128 773086 917584 504 518 1562 90 619 503 377 731 720887 730 1270 487 1 594 912 185 109278 715 913 45 1620 30 861887 102 212284 276606 9 95 551 257 249 523540 1636 266979 670 177364 884946 1434 422603 445225 140 457680 753257 424 98 607574 1870 229 175 696737 714153 928168 316 244516 1721 794 301 585 714153 723542 0 983194 999668 1175 736533 1489 551176 1003 393 394 12 1917 994 785221 948022 509 1923 248 749 961121 986 11100 1168 322153 5656 48 392196 556006 53898 585514 960 139 1106 855 1748 148 88 1626 864 1069 1624 412423 573013 1237 493 2085 948022 948022 398 444 830 1361 725 1865 273389 827964 686771 652 392048 814957 271 494 1190 421611 445199 1007 1135 254 937 1185 799 729875 573013 624727 712 593729 593729 1290 67 1508 2190 664 101888 294 868716 971 1338 413633 529 1246 216739 867947 362897 1464 472 340599 1109 438 254 467 1535 110037 796838 399 486 582 958 1499 876408 903347 87 83 673281 962503 430 861 621 660713 868771 731 2129 307 823 1337 231814 24 644971 251770 585 459368 308 62 1262 1886 60197 252 804 2049 1678 165 365 663 388 390 356 594 1176 510 82372 2313 935 1440 1392 294 1205 627 201 716 149 132 801 1277 1103 1873 1040 1451 691474 999668 156 1046 1652 1004 18 2364 411 1447 1591 34 955 303269 877273 917584 1226 460733 466 249789 1890 361 122955 863077 1581 2203 111634 725400 1020 1341 372 225213 885953 962722 842 997459 370 186240 596667 816 1 29 808 591134 1253 702 202907 1074 265 1668 338 500967 1920 697 1963 52 1811 59 436 97 377832 949054 1555 295634 681523 2045 3 861 254 2328 1294 336 1336 898 433 421928 585543 973 421736 615579 763 434135 1036 815 106 854 123 386 1353 2618 158 708 1347 96402 703775 51576 183937 999668 999668 1784 1847 554 310 1149 1375 98 894843 1707 1221 185 661 2065 1027 1337 175 603 140 1584 338 1135 483 443 518 1910 1367 582052 678226 2062 269020 903347 446 504 2275 2067 872613 1027 278 1996 49 173192 295179 468 858 51158 511 635446 837042 397 1471 677784 846680 814 1312 366911 532616 1320 2149 875788 972765 1678 508 1021 52912 295374 61 369 711 26191 345319 870 197 1370 1386 769158 561 1573 534136 1205 255 948022 990514 150 934 81 1292 273 2266 111 310 212234 333 1455 1359 1410 1224 901326 333 1725 960 822492 1538 97808 19 719479 835680 1832 316 1997 200 42 344998 730152 229 1402 1280 2181 215 131155 860 831 157223 795 582052 834714 1082 86509 982613 783 1732 1229 776 1157 1179 1364 381339 326 379 1881 92 493 409909 1193 177908 276 863448 1684 925 169842 575264 1630 844 415 913 785 9 1394 331 836 1045 1102 669 729875 901983 321 513629 804061 1176 508 2137 1824 321 621756 308 1682 491 91 282 985 100 455 149157 411479 2985 1451 438 245 626 1064 2756 857 1008 2078 129 566 341 1347 1123 1193 649 383 818 355 1832 473265 827399 1433 836060 990768 1059 442293 37 2171 274 476 980 651 893766 916893 321856 858069 682 6 1222 1406 109946 2040 465 174 237 227 619196 2946 586 1240 594 562 2439 1116 55999 1224 26191 51584 2436 189 61 433937 1338 2259 1520 1645 882 1086 539 665354 1361 2132 508186 56 284050 824 2026 1034 1487 1591 1185 774 191 791 2781 1425 392196 692 578 919798 88 540 674169 258 972825 1725 112 561 505 1435 321095 604179 812247 1255 806 333251 813898 11 977 119820 22 1058 1347 2129 311 345 912 977618 422603 313 2790 1948 553 458702 716516 969 877 63 2368 557 647 53188 958609 109 2380 1828 201 269926 318 432 2058 160 842 2618 241 45175 354142 100571 572 390 709 314 798 439261 905441 417 857 2654 411 981 145 828 1854 480 498 1312 70 1081 1364 863 148453 2499 1704 2888 859 360586 401 442744 905441 999668 2127 2220 321 156 1933 118 585514 1518 753 969 1707 745872 405 610 1279 2547 1392 240840 321 972 13 110287 221883 647 300 2391 591896 1295 2245 2284 669104 875990 662 308 649 724 971 28313 280 20 430 203 467 1404 565450 695 179875 179875 2085 795099 867976 700372 750653 49 959855 972318 597555 630414 1900 938114 449 1498 680 842348 309 731 471 780 719870 916898 250 806 85 394 684 669 2249 1646 1645 88564 214357 981 632757 1381 1644 3017 396466 3069 135 372 944 889 1237 1053 524058 459 1168 1638 2585 122955 948296 198 750389 972238 68 2750 839 2840 847613 939404 173 2857 2328 604 1202 426 1634 590 171 310760 550385 90 469 1032 871653 862 39886 426797 398 1311 84153 220 589181 607574 310282 859499 480 943595 1752 2139 2750 1937 347 2125 82612 52 297 874 476 2301 303262 431501 1514 667498 893926 979 244 50 684 137 61857 1037 95612 650307 1340 846680 846680 13 657 1299 722 1332 1827 76 905866 929659 1429 1106 855 1564 1166 890 83 2277 594926 730152 533 675 559 305 1046 181297 779881 1753 1576 180 1349 2357 666894 698454 397390 1215 1644 706780 1460 2517 1462 780607 893776 737 852665 2155 738 325063 529 1604 465 488 812 1651 1052 94710 668 38353 905441 1472 2381 718 1386 916893 999668 1923 929648 948383 1181 1563 650307 524 301002 24 283 410 243 707949 884742 1702 270667 497319 884757 413 571 1346 2682 1768 969 1875 1283 119 307 207 1331 67361 619332 867745 451290 534 77 177364 2363 2228 991 403 394118 708364 1183 2464 538 585 350 679711 1510 992 235 1859 739 850 1680 45687 174105 2272 836060 948383 541 183 1472 476700 680553 1415 1343 1128 640 2792 1752 1012 1633 1239 64 880 271 32378 1064 1534 410 171 418617 51 19108 700119 2029 565510 619196 2717 194 792 134 2925 209 264890 184 716 1252 153 63 399111 547234 597657 891 589 766877 2434 52 2364 986 917584 2667 60 2067 539 717774 171 8 224207 273389 482 816 577 552 1582 422 364 1511 547545 752522 2367 473265 822492 47 2747 291331 430 200 214833 567492 824 1420 25 3072 172 568321 999668 3368 1604 2523 2738 2575 263 1890 423865 785443 1435 2830 690 745279 765994 864537 570 2067 861 861369 940456 3223 848 873506 815422 959855 1236 216790 807194 930850 1196 722 551176 807194 2289 604 612177 418619 380 653 579 2901 766591 990065 2989 335798 581309 46 668 3410 2908 1898 207 81867 181297 1322 1108 842531 1604 591134 981198 866251 45687 537955 365 188 1095 848151 990065 984 2071 1018 1542 312453 868206 202232 219 1141 2005 1359 1428 696 1133 2976 366734 959595 2365 460 2874 860828 290 18964 558609 3502 868716 972386 1251 2058 865656 342 2978 317022 627 693362 949054 1588 2459 603442 1762 421 362 2514 89341 267777 1297 1898 891 841 631210 959855 272 31 2399 2130 476 1771 903347 276382 1177 433240 796873 100 877176 932101 572 2256 139 3427 1045 172816 579313 1637 778706 1014 1433 28 3270 1989 66935 1924 1884 670 3235 807121 896301 252 195 817453 1136 637319 192935 796377 244739 322748 869 1952 2942 589329 1125 953 755892 1967 327 149 3310 1667 2677 1639 431 678537 1828 1082 2262 631457 723542 12 88486 173507 979801 2007 2973 321 593 2007 919439 972318 96 224950 416386 2228 1189 1545 840 76 949 292670 2990 76 735330 746502 74 1274 3392 1579 3392 711411 276 145909 2260 3170 752 1326 988 696 1598 340125 1437 269035 519299 2831 1883 1027 2531 2174 940950 959855 719 1940 2896 1552 2184 2802 1914 1344 1038 732 2030 810099 655 20 1011 439 321 83 1768 199 557 1405 2803 426 454002 972386 979801 3493 552612 425510 949054 1440 888483 897 1815 3239 1304 2351 1943 1368 3490 549 2623 561376 848846 587 2932 2530 717774 3262 641644 694194 1383 352 3623 309 363930 50 2097 3278 326033 539107 520333 796873 816 115201 786655 706 3225 274 278 785 3158 38 860 2995 2559 187 1512 894 2122 2119 70358 1981 962 179096 1270 327 454 1114 2098 442 3557 1151 393753 1075 306156 1703 378 13195 204 3897 3805 23510 1089 725 2464 1153 487 654760 252 1223 2296 620857 971839 1963 2165 3063 1606 508496 1187 477909 969778 1610 1498 2913 3071 428079 105733 701418 682 2098 1958 1958 110287 691391 979544 1703 1996 39495 193110 1849 216 1776 442 158263 224885 397208 764 670 904165 1654 420 475 684 681 392196 993 819 1778 3082 261 179889 3817 2360 791732 773 109 958 549 1590 2254 530812 1141 314099 41833 3809 651544 103 852645 2662 526 746 224885 432547 3115 684311 344 121218 1127 2574 475 1431 745975 753790 436 1083 627 795 3228 1998 1087 849246 911310 2482 1860 6279 449 1587 758 28672 2540 356 233316 878664 12 2642 2981 115 296 901326 3575 215102 581526 869 2260 39886 468614 290 1737 3360 591183 888424 202 27 529757 961121 529439 815643 2548 528 128 635752 144 263164 2424 335925 622990 291 964 317 1006 109 156291 308259 3332 454978 694660 108 596 677 1117 538416 870164 361 3654 1996 1615 3451 861573 2074 138 1167 483 1770 2411 279 940456 1917 583 1916 2345 3025 508496 807755 2533 979 397 525440 2678 799 1036 52 1813 932416 999668 2188 219 1061 3667 1024 468175 468175 807755 959595 1145 2349 440 505 660 8700 879428 472 135619 2548 751195 577409 570003 870164 90 432853 807755 1604 2930 3802 364310 959701 537826 602030 84 476 2362 876 3290 722 338 1578 4481 2502 644 244 119 317247 1477 377845 530569 408 685449 870455 1738 685449 728138 130 208 184 1197 502401 539107 3919 753 1402 1867 249 2121 384125 1074 1958 1083 526 363 2572 798269 838748 457964 677784 2083 3090 2602 3740 95 2438 714 1574 901678 449248 153 475 1958 39 215 2475 1886 2949 1099 1301 63623 999668 670 1231 593306 624377 1841 483461 645735 3940 675 318 526 1768 174 919 3023 2658 1400 3211 817075 959855 971559 697 221 2775 210801 645370 1295 1375 388223 921605 110081 729354 876 1588 1052 3764 287784 1100 1609 422 4415 2021 582151 685473 834 727218 863150 2978 1785 734 453 660 829 2317 480615 787920 2392 2023 733009 276727 294 1971 601 2937 225804 1516 1980 184892 613 3211 4363 3755 500 332 949054 979372 1128 590701 1555 754936 959595 1079 895 295765 612177 371419 1097 951 385 3361 625 2589 844856 2891 612177 989514 4420 710 808 336210 346657 3330 494 114539 35 602030 879598 2211 2683 503877 4433 3511 636 491114 888483 1377 1825 142 3579 2394 786655 959855 4158 1612 583 1636 283539 902 1045 1031 655 24 1456 3142 1721 11833 1822 1479 796873 941011 754105 979372 3849 850413 4396 747 698735 911129 932631 2303 3885 731941 400 2556 2687 4002 2646 1450 2144 959595 979282 1376 2600 940 338 1464 1693 1903 1478 476 68 81730 741 192 1307 777 97663 502 425 214885 2043 1111 2370 936 1352 1205 959595 999668 2859 889615 3369 797146 505 1889 210801 133 890323 1202 834714 407305 644729 777 600 2908 549 2052 323 733140 609372 3218 1631 288 178 1817 907 852903 2486 3229 1712 1186 676 1297 798 4520 2443 480422 861887 950 278 1935 969689 1561 100596 1161 70 1650 337 2850 2053 638007 935542 2630 1843 903 95 195394 910489 327 634581 1402 1902 505 967 598264 2208 68 983 947676 761 3175 91370 862127 454 380 179 164524 458287 2151 852 2561 2684 1155 2714 307197 358822 2339 2855 778 91080 276631 226727 436134 205373 1481 952 2251 37 3588 15 4148 158263 1875 5231 2340 505702 2557 124 1001 602509 685473 3008 70 226986 785953 542 3165 1920 1279 99 1842 3248 1853 3199 11833 3461 1669 884020 2618 1172 41245 746502 125429 560847 516 210958 666174 2069 3006 104646 135 410 3507 564 2444 749 3370 3982 2297 507 839331 1978 736533 537838 369497 735255 837430 1534 575782 2291 349607 756 3643 706 394709 490718 3816 1324 877704 877704 2943 2004 21331 860620 340 967 979279 979279 760 3823 655419 846220 1902 1275 1630 784917 948215 1123 171 1340 352 871 107444 569042 969809 452 1389 614 569013 621089 153837 356882 3007 3881 1041 194961 284014 579 1617 81 4547 706 2517 402906 792 683798 713890 584 220 2562 613 3771 933 1288 810 795445 896321 2596 2521 774851 668 842 954 537231 558609 1547 1474 1962 839 2375 639 3008 2853 1073 2667 499610 1046 1119 694308 1408 1063 1739 995 2624 2440 548 672 259 3613 888 2619 1241 814547 3822 2717 1247 661 226278 379137 958684 969809 2307 1802 1114 1071 663960 948022 998 1658 1667 4175 959 1230 921 2325 14 2406 2224 4545 803330 823 4775 496863 868716 272 1632 338 441349 673293 806304 4237 1204 967708 350 1125 119 969809 999668 963895 221 957719 100 1798 890 2316 5072 1662 1978 918604 988891 784917 999668 950 3267 196058 796377 1515 536 2850 4244 1005 1827 1141 330 529322 703230 2824 1169 1265 1385 4024 4121 1577 116 381158 26 3979 1923 34126 3432 2861 1396 940 391 1712 140 3308 310760 179898 2893 2703 2341 215 2646 959049 2074 3115 898 1033 4360 871 4141 986069 57929 500140 3376 357 70 1276 665952 3082 1806 694681 999668 832 1180 1134 2134 2560 245 4731 1663 63501 1681 2056 165150 367763 205 764992 213 3174 664840 184 2430 999713 999713 2224 2430 1193 465413 2079 3772 583 922 4654 2703 5400 376 969 1680 221315 1520 278214 2678 1975 41799 347748 166 1695 109502 1487 1584 2034 2053 3346 2886 399163 537838 822 1429 2070 5017 1180 1818 2319 1615 275586 896814 851 5324 978 12 126597 797 203 4184 988891 999713 347094 379458 78 1231 3114 3435 109278 663977 147 778 673293 774555 1561 596 601708 639707 4514 717 2555 257657 1187 3474 2484 4656 234 2134 1321 353 1390 2798 3866 2361 695695 585 1173 787 655479 697 4445 1811 333 610 744 630497 674169 1911 580 4306 854 3505 837382 999713 2186 114538 3135 318810 4679 1056 384664 5432 472755 500140 764992 4512 570003 988578 864857 340 275117 714153 3392 518088 723805 1511 1709 2119 2516 350 619 4427 1287 824927 943 1929 804 109496 877952 506 3776 4 1633 1137 3558 956841 4944 382900 2467 1985 703230 3341 871 493 2546 1215 1826 815643 861099 1173 944 1264 1134 792091 4594 1574 807186 999713 1347 357 1508 44880 4010 76 76 185 779731 262507 999713 999713 2510 164761 683798 1960 4064 1061 732060 1980 1996 356263 102413 385 1233 441 3119 832771 5513 691733 3156 3786 244 1955 566 1826 370 220 495109 2227 2282 3277 4833 175 57 119 772 2461 851 1534 886576 979136 331204 318 3540 2520 1001 118552 406456 1184 3208 1697 247824 3232 2663 2341 1850 916 859 3351 1255 851 264 1295 278502 314 1626 2395 2312 983 32261 3571 316 4006 3461 269039 3856 406155 570317 2556 2317 456267 744570 184 1012 904 1545 2566 310 972 609 405 1732 484 624676 2518 804 256407 1995 590 4528 258737 471 733051 744570 774 1838 509685 127569 266511 1260 453732 837202 909376 676 800254 2038 529 2814 166 3954 282 1028 5126 11778 589423 2966 5314 1436 2503 1130 890 3190 1536 146046 216893 4441 929 1256 4279 1753 396 652 4024 351 4087 2653 414 2302 3097 3740 600 4114 2852 651544 763818 543 3702 2262 334 3535 4108 4 210 3644 455476 896731 2641 4762 307 434 417553 686 806624 988319 3659 306251 312 3314 202848 989 473 335756 836614 355 5405 243 91667 456 1111 804120 114 943 2058 3077 2440 226727 940005 243744 348938 2075 937 1555 4592 723 144 703278 3250 2108 1654 304664 377845 2571 4779 1718 1635 137968 877704 656 1145 2228 1274 30981 725 694 4256 2604 391 364 1027 83 3763 561 686267 3118 356941 826815 2883 2583 1448 5074 2590 329 3544 490705 722450 773360 969689 551 2043 982528 3944 2738 2202 867745 867745 3289 4230 2664 21651 784299 2316 416381 764226 2662 724 908354 999713 837 226 2902 1559 1276 2117 1445 1692 406053 2106 1746 3089 1295 506 264 2982 154 28 57929 283539 394 2049 3532 3323 1378 1400 372 647 3098 722 1638 1266 889908 635446 445910 612177 2211 2117 435779 468614 3425 5117 2193 458752 1669 406 560529 723777 4378 3167 1568 3247 843 5113 174105 4805 957719 3187 5055 541 317061 308 265 596173 895439 957425 2063 77678 102421 2832 72 5435 4327 590 157331 560014 1760 659 875 491094 978692 1071 1042 1076 2125 4436 4196 592 4113 380 3789 148514 490718 2490 911 1034 4327 176785 528829 3335 650813 87 562 1675 3939 537680 878100 844951 939562 1801 1800 860 2391 93832 2355 409770 3436 569648 762881 1862 3729 762817 345216 999713 1075 1416 1929 5380 651 5034 2701 1755 722445 782827 4363 769 3083 2233 58008 335283 290285 500076 813392 907782 506858 1631 2661 16 3080 1219 10678 506342 1200 3179 711170 599476 2393 796 42 10678 930519 900728 2148 4448 3850 16648 1668 766511 481 2954 2689 993 32235 957634 2116 4388 24 1069 1760 1527 1806 3029 167886 803 806 752756 764340 3504 689978 2731 2891 1763 820 3155 1425 552 893715 2445 1319 78108 4468 3245 41283 93832 1701 745442 4214 718 698183 2811 851 34311 783 1622 1115 1594 2053 196 1630 4050 2921 1875 2768 1806 1619 2563 796014 5851 3547 3434 895439 968971 133 3864 381 2370 6017 896301 2133 2005 1749 4330 93576 435375 3713 2689 3798 3944 1117 1972 5720 3097 217387 477754 1668 449 806624 4186 825 793 105 1174 1150 808799 2739 1244 368 283862 548177 1287 2170 919137 999713 2979 591 4078 2688 614 5199 120567 732562 2562 530 4059 324998 558609 149 629215 1755 2525 570 2766 1628 1334 3502 5343 3019 3326 793 171 1135 4428 228321 733009 1146 1942 323 4129 2989 3024 741098 474 1663 56 178744 248697 1860 635 2981 2606 439 920 756 500282 621089 3209 1239 111150 138869 1417 170 1679 940037 948215 390 664 1925 1011 84823 445978 4465 3954 192998 4269 995471 4124 30 436105 930698 972 731 871 876 748451 640197 753974 417553 529322 3417 342 784 3143 928 1878 2401 403 334492 4772 2046 1358 986 4779 896 609 1110 905441 2902 720 358068 389176 248936 909078 4538 2264 916 683779 796277 3293 879 2402 3108 900 934286 4122 694194 860130 2601 18 2200 4830 5651 4513 316 621823 715078 566492 940417 948383 892450 4260 514866 2309 2299 3156 817 4425 877704 958575 1138 247774 233 3049 2984 1509 4401 2013 234 2150 1452 3581 611186 919439 810 557231 
@@ -0,0 +1 @@
+432 164 23 394 489 374 467 188 380 109 283 578 100 50 130 325 256 42 6 196 422 509 151 805 140 105 231 399 116 448 505 417 40 345 249 37 363 98 219 496 411 6 412 649 297 354 255 75 116 781 564 286 902 731 52 281 297 504 94 439 623 826 562 964 273 348 49 529 824 74 704 430 260 221 562 36 491 158 11 684 256 693 221 239 428 21 415 53 144 521 427 199 237 428 67 10 333 596 135 240 406 417 113 43 267 371 303 171 740 521 117 486 276 550 367 534 182 221 413 266 714 267 96 609 848 384 265 546 3 127 535 498 149 438 452 136 105 925 871 484 64 6 743 240 97 218 327 372 196 964 27 505 458 305 594 117 603 243 52 842 855 9 112 107 189 373 637 485 924 105 146 530 342 79 35 261 732 553 429 496 338 587 760 162 431 7 664 493 135 412 125 401 353 575 0 121 703 183 653 167 116 783 378 90 467 449 374 104 128 187 137 152 726 498 871 527 879 124 92 493 802 29 593 167 471 214 199 875 768 396 666 203 29 755 570 191 113 231 13 57 561 356 144 130 199 492 113 758 765 441 516 392 806 174 372 328 457 117 782 43 184 342 34 60 301 141 557 574 929 620 24 362 59 821 165 161 45 443 96 186 223 127 242 121 136 565 374 108 338 379 105 311 249 943 125 963 190 376 125 788 257 526 680 60 357 449 869 32 177 32 189 436 514 712 366 235 14 389 431 670 325 149 182 557 576 72 268 765 199 491 291 331 76 437 230 70 416 259 119 902 44 194 62 761 705 52 701 433 104 301 489 464 438 811 243 931 600 201 69 328 113 440 184 139 763 303 540 415 95 415 254 123 502 104 95 7 79 458 643 192 361 413 159 8 36 267 455 252 197 298 694 60 78 681 921 70 112 897 201 72 78 613 1 170 385 53 844 179 811 667 470 120 152 341 624 95 147 338 120 281 124 240 17 310 327 272 317 252 248 155 974 477 112 294 669 290 97 166 36 43 912 528 244 98 493 441 686 71 557 117 474 402 0 62 145 99 664 296 423 553 454 229 262 388 24 467 433 354 258 213 403 57 34 83 452 347 492 372 376 8 34 359 504 212 202 399 435 714 664 250 458 759 199 99 56 206 211 415 952 106 601 62 539 160 285 588 154 586 154 168 386 807 490 520 41 438 48 141 19 329 472 569 585 253 157 805 600 380 409 623 208 311 423 300 8 161 884 62 179 35 204 830 589 200 49 395 294 744 649 255 487 581 357 88 377 568 732 37 323 562 508 24 722 94 155 344 432 21 118 809 779 165 91 207 68 115 369 155 234 107 465 123 452 559 269 148 929 589 672 649 18 301 111 401 232 7 36 20 494 213 96 866 189 167 212 845 213 210 847 131 159 424 95 729 38 102 772 107 501 6 225 443 309 218 137 169 69 131 78 842 391 33 378 438 829 736 385 398 63 68 150 301 179 406 438 300 304 277 442 255 28 13 606 66 69 630 105 292 54 30 506 250 567 231 4 94 499 51 139 506 78 20 778 182 64 663 246 139 306 1 717 394 173 361 625 222 458 697 38 28 207 68 366 579 410 44 166 123 116 279 1071 717 679 290 278 854 998 350 1055 39 1250 1434 839 493 1497 1552 1210 153 839 4 1557 1777 346 1347 195 1300 723 598 478 8 521 1283 582 851 1674 1310 326 441 1878 73 358 426 1411 945 317 828 1091 841 1052 490 260 961 184 352 130 59 1031 1027 1360 523 1617 180 1317 624 228 971 505 1470 434 514 550 1214 671 431 78 808 1895 648 80 119 124 167 1332 457 642 1580 397 662 1034 224 841 1144 508 17 241 75 609 502 594 509 141 1932 500 358 239 101 106 1328 137 1200 249 1490 332 1439 457 444 430 1282 311 504 1013 763 186 679 1311 205 660 703 191 56 136 628 806 200 388 389 1202 1273 282 744 264 441 300 192 129 1243 266 438 998 1324 128 752 862 656 1048 1326 93 306 739 1043 1457 229 182 328 967 357 121 729 831 298 123 143 632 757 1405 313 659 821 308 1269 1244 277 282 213 25 1103 1175 433 859 72 534 566 8 460 230 1607 218 1280 52 146 472 234 1324 624 280 1508 743 58 352 938 203 903 349 76 522 301 349 1246 523 153 1458 218 98 782 103 1008 439 1335 590 860 108 460 1057 817 236 1043 1245 91 1150 1 549 979 380 1419 359 840 302 174 1234 195 330 749 493 223 184 347 1293 608 945 747 929 1149 298 711 418 1201 724 788 734 59 1248 1046 793 1306 207 216 360 75 160 599 839 884 929 166 439 472 1048 325 28 1488 693 670 585 21 1007 267 1400 266 485 1046 509 117 1191 1065 1005 778 377 413 353 1218 384 1135 988 878 1079 1673 245 1262 212 759 848 1133 1098 922 493 978 826 311 226 1554 380 447 960 203 1377 278 156 60 824 631 1062 319 787 1464 225 325 1163 1030 390 1356 1208 1266 1086 74 142 278 1352 157 1635 1058 508 454 753 1394 130 48 179 1055 540 1149 386 1473 286 332 165 1495 11 1252 743 548 857 629 567 1834 768 468 200 788 78 991 755 593 1462 264 1452 120 9 720 1143 122 457 667 530 1374 1443 755 895 131 745 870 777 404 199 138 983 1445 82 626 1175 896 766 28 741 505 613 1420 796 433 749 455 855 1835 27 1017 27 72 746 1101 105 273 791 828 821 23 283 913 242 1015 1185 149 201 283 1424 1573 1007 201 1322 203 658 248 1730 45 1560 1021 1315 1526 647 618 965 222 342 420 369 163 145 898 41 464 39 726 519 0 237 994 998 1142 1881 965 57 160 272 1027 695 608 1570 1492 321 886 1222 944 748 1628 943 223 598 822 1218 1079 542 189 537 195 356 787 205 331 1884 779 428 1176 853 344 1238 1212 930 518 1574 700 683 623 957 730 924 1304 1675 329 72 48 823 580 228 950 309 70 102 1828 47 267 1249 503 1673 1075 712 1321 1282 454 199 1156 7 1588 1785 331 266 534 169 973 211 238 435 1142 871 136 818 94 32 1151 288 1243 295 421 1127 1102 215 104 83 605 466 451 216 867 175 189 804 277 642 804 46 185 232 1720 481 130 1241 131 531 713 333 592 282 559 232 117 974 1173 914 105 77 311 799 1278 1206 140 180 827 68 962 502 1016 673 511 702 950 1166 269 694 753 1162 1017 690 441 958 1317 643 154 111 109 385 567 419 205 639 781 803 753 297 1116 1539 68 481 192 84 240 1717 614 752 491 16 1298 711 321 1201 1044 775 717 801 982 4 12 938 416 650 405 1251 903 385 389 1105 1040 620 1526 1105 452 1244 1155 449 865 277 17 33 898 1712 1715 1522 1043 204 870 719 1115 1777 1638 184 453 1195 334 964 531 340 34 1921 1466 1045 2304 487 1431 837 1208 2457 1677 808 1072 2707 826 1672 2484 1738 1576 292 1520 911 1508 648 1099 749 2354 1248 2048 452 1571 607 1760 1779 1245 563 823 618 1209 106 851 503 1013 340 527 1815 2747 1108 1257 1589 783 595 182 1834 377 2294 602 83 1027 88 2436 1919 2326 398 161 515 1588 922 618 661 193 1805 1772 689 1497 154 2290 1004 2357 1756 87 341 2056 579 1614 1719 720 84 762 875 654 678 1407 671 1829 831 2068 153 425 1686 471 689 720 1140 1646 1257 1648 190 344 1760 791 2319 314 227 2502 1631 1472 1000 1645 2793 2034 1142 403 500 917 238 574 949 1510 2104 1645 1643 672 1054 479 591 1105 436 1757 287 1300 1713 137 411 2215 430 986 372 341 26 139 280 956 1073 2586 2513 2409 51 492 463 1745 91 818 1127 1009 558 760 1825 845 2605 414 1092 1766 482 1132 992 1933 532 1209 1755 153 765 1314 52 175 788 827 230 2325 1148 1626 1948 1627 735 281 2116 1284 889 735 1037 1527 2058 1356 745 790 862 547 78 639 799 1591 1618 231 124 2216 302 474 813 1712 1009 1228 1356 674 2013 1906 161 1029 1062 173 536 1397 870 2380 454 954 949 93 1400 1456 1965 422 1019 1042 1831 703 22 429 2409 1209 2167 1822 1401 1100 43 621 975 673 1447 261 217 1923 1087 46 223 2332 1621 2477 972 19 1434 524 181 1266 456 1282 876 1431 218 621 2006 1888 356 2127 1986 639 1474 98 1436 297 1385 2043 540 516 1019 475 152 1487 686 744 1265 971 521 234 1531 2038 965 993 1182 2814 902 1427 115 2353 127 94 2561 1185 244 1996 471 290 1064 578 325 1598 1164 91 37 2102 1862 1002 2310 396 133 691 560 1403 653 1590 2654 2915 2605 1043 1862 244 234 156 263 1180 1505 215 140 1989 2465 887 2494 607 540 1178 948 378 493 1938 1830 887 1466 215 428 2087 2313 1512 1454 1102 1769 1009 291 812 2089 980 1447 2517 2414 2356 572 861 1723 380 292 539 480 1310 587 748 787 1254 1222 853 586 1410 510 562 1187 89 224 361 324 1279 518 167 1484 1015 283 196 1414 578 838 15 1054 634 465 1072 402 208 126 468 1140 376 572 39 1894 2328 672 322 425 1140 45 1506 758 275 1356 1608 1137 728 972 59 94 408 738 655 2136 736 469 615 1394 307 1159 1320 1290 2017 1974 336 1023 444 299 2060 1479 718 363 1103 2716 1691 414 2759 1224 1006 1281 225 1157 314 361 909 419 2242 538 2437 2195 12 1177 1930 1416 348 814 763 1217 102 114 1763 1287 460 1830 1813 1504 74 1148 89 267 2258 2488 539 1015 1261 1613 757 210 686 85 225 136 378 498 732 804 657 627 888 916 561 59 1221 1193 1401 485 906 125 807 2346 363 1980 1171 1018 476 1642 80 446 1280 193 1542 395 1945 1724 1141 598 506 1805 1730 540 281 1527 459 958 40 912 2404 677 1350 1962 1845 1015 437 1591 1921 2192 1103 1943 871 1796 382 1311 987 908 412 60 699 1047 1561 1410 699 699 1545 632 123 806 250 276 1156 189 2799 616 34 324 1626 929 1285 2084 881 997 1352 2223 749 1672 578 258 2131 519 572 1130 845 838 1750 1469 284 1516 1343 208 524 1267 1773 354 706 580 1145 2391 1066 1898 403 1619 939 1742 962 325 1049 436 1285 45 1984 124 360 1355 1555 202 642 2077 300 1814 414 1549 1821 492 53 1755 904 47 1334 1394 562 922 409 1102 1183 756 1443 558 402 198 603 982 1037 443 960 1932 134 1351 1121 2455 228 1706 491 773 865 876 1057 180 791 1508 2006 2526 1117 1457 1530 950 699 720 775 2880 2494 1194 2962 1633 832 2769 2298 3507 768 406 946 1168 448 2041 2192 3287 1904 2044 1277 2303 1690 1151 623 1135 444 928 1356 1210 538 1085 2128 3072 1171 2098 643 2560 2562 2533 1467 2081 433 985 1506 581 1606 346 661 176 1823 783 235 2118 726 621 79 1099 797 1039 2191 731 346 170 261 632 675 3660 1348 629 1093 144 1520 468 1000 638 738 1672 1425 242 3441 702 559 1222 1713 854 243 3680 1591 750 334 1940 1270 530 2419 481 927 1568 953 762 3150 699 2676 1173 342 2331 1682 524 1343 2273 1174 3306 2480 388 2720 2787 920 3126 2044 232 1760 2639 507 3173 727 391 939 609 662 462 784 1235 373 1467 1895 1770 3130 416 1830 1342 540 280 146 895 2538 322 3181 371 871 1492 88 2137 71 1473 1751 3410 1075 2814 2255 1019 1446 713 2753 804 2187 1073 54 3141 2254 2069 421 3687 1628 686 1688 1272 719 303 837 1665 396 649 305 1972 2437 2624 982 2316 1883 2410 2246 1814 187 1661 1066 1356 1120 544 974 765 2671 3154 877 284 42 88 927 673 1739 2353 3083 167 1740 3342 1886 951 3495 1732 133 1874 1554 1787 596 3511 1380 2452 2136 2686 354 177 3097 1247 1274 3354 2021 1698 2374 3024 519 345 481 535 2906 223 868 3583 1799 739 803 2890 1697 1508 1123 1438 1364 419 2002 360 106 716 638 829 338 13 1113 1703 99 1279 932 96 1309 2196 3317 1416 2108 1692 662 1239 42 344 160 1887 432 29 1963 270 2327 91 65 896 1176 859 349 3267 974 125 2191 1528 2713 333 2812 989 430 3712 1054 695 2435 808 2344 2105 800 541 43 848 575 596 3194 2032 1977 3214 1140 1275 400 1892 2769 446 1681 1579 1739 2291 504 208 395 2549 941 682 1227 207 1643 743 2716 2058 1574 466 136 44 1330 1500 1333 1504 247 3578 3318 409 773 451 1610 447 2568 676 199 1226 100 682 171 6 454 3586 1312 1189 920 128 39 826 592 2044 63 1115 3691 686 3209 2720 333 1483 1359 472 184 1474 2029 3914 35 2771 192 537 2065 1571 800 48 1813 2318 435 1125 2391 661 963 1451 108 5 1412 196 1847 1338 111 2974 2147 823 126 1834 728 3070 273 702 647 2012 427 858 92 2307 481 340 1031 1221 658 313 1470 3583 333 33 885 1788 1003 2002 47 909 1753 134 2400 614 1013 770 1748 61 321 618 1995 1930 141 2257 2133 278 259 371 3464 491 666 977 2142 2394 2342 1047 973 2426 2335 852 509 1756 1976 429 3013 773 2807 551 85 2180 3133 839 330 559 198 45 944 2272 152 527 1175 690 2364 1847 1458 3538 1328 1386 40 831 2087 720 992 1201 2669 707 1463 1879 512 1169 491 2031 1867 2630 276 1056 149 2353 2963 2142 3033 128 1438 1298 2166 2207 1740 921 1565 2601 1685 1424 307 814 1687 966 714 1153 461 1917 2756 373 642 3338 448 1287 1501 2133 1189 2110 238 353 869 144 1386 1856 394 1411 1298 1696 82 1928 235 1425 15 1967 2637 1946 1387 2191 2003 220 3039 867 2067 1478 1556 1094 1562 360 506 591 105 1328 799 1611 1068 468 2010 3282 50 858 55 725 2471 1571 2879 1144 2179 348 1298 848 490 1351 1301 3395 1 755 570 678 1504 152 524 2010 874 2252 2815 3236 1032 1566 2231 688 113 3128 1554 1363 1131 882 111 1441 226 2715 2282 2256 1576 154 863 170 117 1490 1646 2050 762 401 688 594 2711 437 1927 2042 1162 1410 1829 1099 1443 448 1847 1711 2263 1337 1214 417 1232 1915 2694 2075 843 277 2084 1026 2076 1336 2484 2246 364 1565 2762 
@@ -0,0 +1,50 @@
+#include "command_reader.hpp"
+#include "workload_format.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <unistd.h>
+
+// Converts a text workload (k/q/d/s/p commands) into the binary format of workload_format.hpp.
+//
+// usage: converter <input.dat> <output.rqw>
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "usage: " << argv[0] << " <input.dat> <output.rqw>\n";
+        return EXIT_FAILURE;
+    }
+
+    const int fd = open(argv[1], O_RDONLY);
+    if (fd < 0) {
+        std::perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+    std::ofstream out(argv[2], std::ios::binary);
+    if (!out) {
+        std::perror(argv[2]);
+        return EXIT_FAILURE;
+    }
+
+    RB_tree::Command_reader reader(fd);
+    RB_tree::Workload_writer writer(out);
+    RB_tree::Command cmd;
+    std::size_t records = 0;
+    while (reader.next(cmd)) {
+        if (!writer.write(cmd)) {
+            std::cerr << "converter: command " << records + 1 << " ('" << cmd.op
+                      << "') has no binary encoding\n";
+            return EXIT_FAILURE;
+        }
+        ++records;
+    }
+    close(fd);
+
+    if (!out.flush()) {
+        std::perror(argv[2]);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
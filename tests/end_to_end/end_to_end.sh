@@ -4,18 +4,29 @@ SCRIPT_DIR=$(CDPATH= cd -- "$(dirname -- "$0")" && pwd)
 ROOT_DIR=$(CDPATH= cd -- "$SCRIPT_DIR/../.." && pwd)
 DATA_DIR="$SCRIPT_DIR/data"
 ANSW_DIR="$SCRIPT_DIR/answ"
-PROG1="$ROOT_DIR/build/Range_queries_rb_tree"
-PROG2="$ROOT_DIR/build/Range_queries_rb_tree_log"
+BUILD_DIR="${BUILD_DIR:-$ROOT_DIR/build}"
+PROG1="$BUILD_DIR/Range_queries_rb_tree"
+PROG2="$BUILD_DIR/Range_queries_rb_tree_log"
+PROG3="$BUILD_DIR/Range_queries_compact_tree"
+PROG4="$BUILD_DIR/Range_queries_fenwick"
+PROG5="$BUILD_DIR/Range_queries_bplus_tree"
+PROG6="$BUILD_DIR/Range_queries_versioned_tree"
+PROG7="$BUILD_DIR/Range_queries_sharded_tree"
+CONVERTER="$BUILD_DIR/tests/end_to_end/converter"
 
 pass=0
 total=0
 tmp_out=$(mktemp)
-trap 'rm -f "$tmp_out"' EXIT HUP INT
+tmp_rqw=$(mktemp)
+trap 'rm -f "$tmp_out" "$tmp_rqw"' EXIT HUP INT
 
 cd "$ROOT_DIR"
 
-for PROG in "$PROG1" "$PROG2"; do
-  echo "Testing $(basename "$PROG")..."
+# run_suite PROG [ARGS...] checks every data file against its answer
+run_suite() {
+  local prog=$1
+  shift
+  echo "Testing $(basename "$prog") $*..."
   for in_file in "$DATA_DIR"/*.dat; do
     total=$((total+1))
     fname=$(basename "$in_file")
@@ -27,7 +38,7 @@ for PROG in "$PROG1" "$PROG2"; do
       continue
     fi
 
-    if "$PROG" < "$in_file" > "$tmp_out" 2>/dev/null; then
+    if "$prog" "$@" < "$in_file" > "$tmp_out" 2>/dev/null; then
       if diff -q "$tmp_out" "$ans_file" >/dev/null 2>&1; then
         pass=$((pass+1))
         printf "%-6s %s\n" "$base" "OK ✅"
@@ -39,6 +50,72 @@ for PROG in "$PROG1" "$PROG2"; do
       printf "%-6s %s\n" "$base" "RUNTIME_ERROR"
     fi
   done
+}
+
+for PROG in "$PROG1" "$PROG2" "$PROG3" "$PROG4" "$PROG5" "$PROG6" "$PROG7"; do
+  run_suite "$PROG"
+done
+# query runs answered across a thread pool must match the serial answers
+run_suite "$PROG1" --threads 4
+run_suite "$PROG3" --threads 4
+# four shards, each inserting its key range on a worker of its own
+run_suite "$PROG7" --threads 4
+# the iostream reader must agree with the default one
+run_suite "$PROG2" --cin
+# read-only phases answered from a frozen index must match the tree
+run_suite "$PROG1" --freeze
+run_suite "$PROG2" --freeze --threads 4
+run_suite "$PROG5" --freeze
+# 'v' queries on past versions, which only the versioned backend answers
+DATA_DIR="$SCRIPT_DIR/versions/data" ANSW_DIR="$SCRIPT_DIR/versions/answ" run_suite "$PROG6"
+
+# binary workloads: every .dat converted on the fly, plus any .rqw the generator wrote
+run_replay_suite() {
+  local prog=$1
+  echo "Testing $(basename "$prog") --replay..."
+  for in_file in "$DATA_DIR"/*.dat "$DATA_DIR"/*.rqw; do
+    [ -e "$in_file" ] || continue
+    total=$((total+1))
+    fname=$(basename "$in_file")
+    base=${fname%.*}
+    ans_file="$ANSW_DIR/$base.res"
+    rqw_file="$in_file"
+
+    if [ "${fname##*.}" = "dat" ]; then
+      if ! "$CONVERTER" "$in_file" "$tmp_rqw" 2>/dev/null; then
+        printf "%-6s %s\n" "$base" "CONVERT_ERROR"
+        continue
+      fi
+      rqw_file="$tmp_rqw"
+    fi
+
+    if "$prog" --replay "$rqw_file" > "$tmp_out" 2>/dev/null && cmp -s "$tmp_out" "$ans_file"; then
+      pass=$((pass+1))
+      printf "%-6s %s\n" "$base" "OK ✅"
+    else
+      printf "%-6s %s\n" "$base" "FAIL ❌"
+    fi
+  done
+}
+
+run_replay_suite "$PROG2"
+
+# a snapshot restored with --load and saved again with --save must come back byte for byte
+echo "Testing --save and --load..."
+tmp_snap=$(mktemp)
+tmp_resnap=$(mktemp)
+trap 'rm -f "$tmp_out" "$tmp_rqw" "$tmp_snap" "$tmp_resnap"' EXIT HUP INT
+for PROG in "$PROG1" "$PROG2" "$PROG3" "$PROG4" "$PROG5" "$PROG6" "$PROG7"; do
+  total=$((total+1))
+  name=$(basename "$PROG")
+  if "$PROG" --save "$tmp_snap" < "$DATA_DIR/0.dat" > /dev/null 2>&1 &&
+     "$PROG" --load "$tmp_snap" --save "$tmp_resnap" < /dev/null > /dev/null 2>&1 &&
+     cmp -s "$tmp_snap" "$tmp_resnap"; then
+    pass=$((pass+1))
+    printf "%-30s %s\n" "$name" "OK ✅"
+  else
+    printf "%-30s %s\n" "$name" "FAIL ❌"
+  fi
 done
 
 echo "------------"
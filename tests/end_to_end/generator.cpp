@@ -1,3 +1,4 @@
+#include "workload_format.hpp"
 #include <iostream>
 #include <fstream>
 #include <set>
@@ -5,15 +6,22 @@
 #include <random>
 #include <algorithm>
 #include <functional>
+#include <optional>
 #include <string>
 
 int main(int argc, char* argv[]) {
-    if (argc != 3) {
-        std::cerr << "generator: expected 3 params in argc and got " << argc << '\n';
+    // a trailing --binary writes the data files in the binary workload format (.rqw)
+    const bool binary = argc > 1 && std::string(argv[argc - 1]) == "--binary";
+    if (binary)
+        --argc;
+
+    if (argc != 3 && argc != 4) {
+        std::cerr << "generator: expected 3 or 4 params in argc and got " << argc << '\n';
         return EXIT_FAILURE;
     }
     const int n_tests = atoi(argv[1]);
     const int total_commands = atoi(argv[2]);
+    const int erase_percent = argc == 4 ? atoi(argv[3]) : 0;
     const int max_key = 1000000;
     const int max_queries = total_commands / 3;
 
@@ -24,14 +32,14 @@ int main(int argc, char* argv[]) {
 
     const std::string data_base = "../tests/end_to_end/data/";
     const std::string answ_base = "../tests/end_to_end/answ/";
-    const std::string data_prefix = ".dat";
+    const std::string data_prefix = binary ? ".rqw" : ".dat";
     const std::string answ_prefix = ".res";
 
     for (std::size_t i = 0; i < n_tests; ++i) {
         std::string data_file_name = data_base + std::to_string(i) + data_prefix;
         std::string answ_file_name = answ_base + std::to_string(i) + answ_prefix;
 
-        std::ofstream data_file(data_file_name);
+        std::ofstream data_file(data_file_name, binary ? std::ios::binary : std::ios::out);
         std::ofstream answ_file(answ_file_name);
 
         if (!data_file.is_open() || !answ_file.is_open()) {
@@ -39,6 +47,20 @@ int main(int argc, char* argv[]) {
             return 1;
         }
 
+        std::optional<RB_tree::Workload_writer> data_writer;
+        if (binary)
+            data_writer.emplace(data_file);
+        auto emit = [&](char op, int fst, int snd = 0) {
+            if (data_writer) {
+                data_writer->write(RB_tree::Command{op, {fst, snd}});
+                return;
+            }
+            data_file << op << ' ' << fst;
+            if (op == 'q')
+                data_file << ' ' << snd;
+            data_file << '\n';
+        };
+
         std::set<int>    tree;
         std::vector<int> keys;
 
@@ -46,11 +68,21 @@ int main(int argc, char* argv[]) {
         for (int i = 0; i < total_commands; ++i) {
             bool is_query = (query_count < max_queries) && (i > 0) && (gen() % 3 == 0);
 
-            if (!is_query) {
+            bool is_erase = !is_query && !keys.empty() && (int(gen() % 100) < erase_percent);
+
+            if (is_erase) {
+                std::size_t pos = gen() % keys.size();
+                int key = keys[pos];
+                keys[pos] = keys.back();
+                keys.pop_back();
+                tree.erase(key);
+
+                emit('d', key);
+            } else if (!is_query) {
                 int key = key_dist(gen);
                 if (tree.insert(key).second) {
                     keys.push_back(key);
-                    data_file << "k " << key << "\n";
+                    emit('k', key);
                 } else {
                     --i;
                 }
@@ -59,7 +91,7 @@ int main(int argc, char* argv[]) {
                 int right = query_dist(gen);
                 if (left > right) std::swap(left, right);
 
-                data_file << "q " << left << " " << right << "\n";
+                emit('q', left, right);
 
                 int count = 0;
                 for (int k : keys) {
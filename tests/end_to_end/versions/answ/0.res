@@ -0,0 +1 @@
+0 0 0 2 0 0 0 1 1 0 0 0 1 1 0 0 0 3 0 1 0 0 1 0 0 0 0 0 17 2 0 0 1 0 0 6 1 0 0 0 0 0 10 15 0 6 4 4 1 0 0 6 2 3 5 6 0 0 13 3 1 0 16 0 0 0 20 0 0 0 10 0 0 0 0 6 7 0 0 3 0 0 0 9 7 9 0 0 2 13 16 0 0 32 0 0 3 9 0 11 11 0 0 0 0 14 0 6 0 0 0 5 0 18 0 0 0 4 8 0 1 0 0 1 0 0 0 11 17 1 0 0 14 7 0 1 0 0 0 11 0 0 0 0 2 0 0 21 3 0 4 5 0 0 0 5 28 22 10 3 0 14 9 0 27 0 0 36 0 0 19 9 28 0 0 9 7 4 0 0 
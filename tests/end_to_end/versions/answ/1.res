@@ -0,0 +1 @@
+0 0 0 0 3 3 1 0 0 1 0 0 1 0 9 0 0 4 5 0 0 13 7 6 3 0 0 3 0 0 2 4 11 0 1 12 10 0 0 0 18 4 4 4 20 7 0 0 5 0 10 0 0 1 0 0 0 23 0 0 0 20 0 0 18 0 15 11 28 0 0 0 23 14 0 1 3 0 3 0 16 46 14 5 12 5 0 15 10 0 0 40 0 0 24 8 0 0 0 2 28 17 5 0 0 0 8 0 0 18 0 20 0 10 0 62 15 0 0 13 0 15 0 0 0 35 0 0 11 21 9 35 10 0 0 2 6 0 32 0 1 0 0 25 0 25 4 8 0 0 17 29 9 88 12 0 0 0 0 45 0 0 0 107 0 0 0 0 0 27 24 0 0 0 0 35 0 24 0 7 0 14 77 0 1 37 0 41 0 156 0 23 71 77 0 29 38 0 0 25 0 0 95 48 60 42 128 24 117 0 7 0 0 0 0 147 5 87 0 4 0 129 110 45 0 2 9 86 41 19 0 39 0 0 0 4 12 0 0 36 0 19 0 0 0 0 120 74 0 22 0 0 0 63 134 0 67 40 0 129 13 179 31 0 129 164 69 3 0 155 0 48 0 0 0 0 6 0 0 0 0 26 0 88 0 98 0 39 0 80 0 0 0 3 0 228 7 103 0 6 0 0 170 91 73 185 139 226 68 0 10 0 0 84 22 0 0 31 181 0 0 0 0 171 0 12 0 0 0 30 30 48 0 0 0 0 0 0 72 33 1 22 175 0 139 7 156 83 3 5 0 31 0 0 61 0 8 16 0 75 16 228 0 30 0 67 0 0 0 51 38 0 0 10 68 114 47 0 273 0 88 130 5 59 38 11 44 83 0 0 0 17 0 0 0 149 0 0 0 0 3 0 0 44 0 20 124 0 53 154 0 0 0 2 0 0 99 28 84 0 0 222 239 16 0 0 55 63 0 0 0 0 3 38 47 158 0 5 33 114 0 61 0 0 0 0 152 0 0 0 0 0 0 0 10 0 116 0 0 0 0 0 0 37 89 166 0 0 2 13 94 32 263 90 0 85 0 0 0 0 0 106 0 165 0 0 0 0 0 3 46 0 0 0 162 85 3 0 155 4 0 224 271 0 0 0 0 0 336 153 125 215 0 0 0 0 85 53 62 37 0 0 0 11 0 0 0 0 15 0 122 0 7 178 19 13 0 82 80 67 102 0 0 0 93 171 124 0 0 0 90 11 0 50 0 0 184 227 33 201 0 0 0 311 0 0 9 0 107 0 0 130 0 0 0 0 0 0 73 0 219 0 0 111 0 0 0 0 0 67 223 172 0 0 193 0 0 0 0 0 0 32 0 0 254 0 253 0 0 152 0 16 84 83 0 0 9 128 0 12 76 0 0 0 0 41 19 0 0 0 0 0 0 0 1 0 0 0 0 129 2 0 5 77 92 0 0 0 0 16 0 0 0 12 32 0 0 64 85 0 5 0 0 114 34 0 172 0 0 0 56 0 166 0 0 0 0 37 135 4 34 79 0 5 251 0 65 252 337 66 20 183 202 47 65 0 0 0 0 101 0 108 230 0 256 0 2 215 0 439 146 311 0 0 0 451 206 0 73 312 123 425 0 0 240 80 118 0 0 0 0 0 0 0 359 0 100 0 0 0 58 229 17 158 66 0 37 97 49 337 0 27 52 0 0 0 8 0 126 0 0 0 27 43 0 0 0 206 0 478 0 0 0 252 0 255 0 0 0 0 191 135 256 1 120 0 213 0 0 0 0 50 0 339 0 0 55 0 0 0 387 0 0 78 0 375 0 0 0 63 295 0 76 50 0 2 0 0 0 0 191 0 0 0 0 22 296 0 322 186 0 0 453 360 0 6 87 0 0 34 0 0 0 18 0 0 0 0 13 39 66 447 0 0 0 0 195 0 0 0 107 0 278 0 0 0 154 78 46 0 13 40 0 148 8 367 62 0 192 137 62 0 86 1 10 0 0 0 0 91 102 0 62 0 0 307 34 299 0 62 1 12 20 0 0 0 0 116 0 0 76 0 0 0 92 118 122 0 11 12 0 0 0 244 0 34 1 103 0 50 0 45 631 164 459 0 0 0 272 0 7 0 109 264 0 251 0 40 0 26 0 163 256 350 13 0 141 331 0 89 52 312 0 0 121 0 348 124 65 0 14 57 0 0 21 0 35 30 455 0 0 0 193 0 374 0 73 0 202 0 284 116 0 76 0 0 0 0 0 0 0 123 175 8 411 0 230 325 358 0 36 0 181 0 0 0 0 32 199 0 0 227 0 307 0 0 116 0 0 0 0 161 0 0 410 0 0 0 136 253 229 0 67 0 305 19 316 0 0 90 0 0 0 11 120 0 0 0 0 138 143 0 0 4 0 0 73 0 0 0 95 19 0 0 191 220 0 0 0 0 0 0 0 0 58 166 0 140 0 0 312 243 0 104 125 0 53 0 110 0 0 0 0 168 0 0 238 0 0 108 0 76 0 11 133 5 24 84 0 204 0 31 14 385 0 0 0 660 0 487 0 118 0 93 0 0 0 0 0 284 0 0 0 0 0 0 37 47 388 0 0 0 234 3 4 231 0 0 364 0 137 136 0 0 0 210 40 83 325 4 452 0 0 0 180 0 0 0 357 0 132 414 173 137 0 12 0 0 420 0 0 127 0 362 81 26 0 0 0 0 321 0 356 100 6 0 230 8 0 1 449 486 28 80 134 414 253 0 0 190 0 5 113 143 0 107 0 337 253 272 0 129 0 314 0 27 214 207 247 0 37 28 0 85 299 22 130 0 105 0 0 0 0 103 128 241 3 0 0 0 27 107 0 16 360 91 0 154 0 0 53 112 0 242 0 0 0 0 242 241 0 52 212 383 63 0 0 160 219 60 469 0 223 0 77 0 432 0 0 0 0 5 97 261 455 56 0 0 0 373 0 574 53 0 384 43 0 0 0 562 0 0 245 120 0 623 0 66 92 491 0 0 0 0 4 78 0 0 0 77 89 0 101 0 755 0 0 0 240 481 0 16 413 213 468 352 0 114 350 213 0 279 275 23 0 0 391 0 284 0 118 0 0 0 62 0 43 0 0 0 80 695 614 216 267 273 0 47 0 154 0 0 51 9 344 76 303 0 26 0 70 11 0 0 0 111 672 250 182 96 557 0 158 0 138 205 723 0 0 0 0 0 0 0 0 384 0 0 0 11 484 178 0 195 0 0 0 269 383 0 0 0 0 0 62 0 0 0 355 0 203 0 129 123 0 24 101 0 280 0 0 0 139 92 278 767 0 0 0 0 137 343 14 597 0 0 163 10 367 506 0 0 0 183 0 0 254 467 0 304 442 0 0 244 0 183 0 110 0 94 0 0 32 19 652 0 329 0 0 48 182 118 0 7 81 0 0 0 373 0 122 4 0 0 0 239 0 85 681 0 492 519 0 0 0 0 1 0 20 0 0 363 0 597 38 78 0 587 45 0 0 0 326 0 0 700 196 0 315 0 0 83 39 0 11 210 0 0 157 0 0 0 0 546 137 0 242 0 0 30 0 187 0 0 125 59 0 270 195 0 52 0 0 0 0 0 0 0 17 0 21 0 183 0 0 0 0 809 278 0 0 460 181 0 0 0 442 361 590 0 541 722 318 0 0 210 303 73 104 0 0 188 0 393 180 303 253 187 0 0 0 344 0 310 0 264 100 0 240 309 0 323 0 0 70 0 0 317 33 561 259 0 833 0 0 856 0 90 462 342 27 10 0 0 0 0 152 0 21 0 334 0 0 635 599 31 124 0 624 63 0 0 0 0 0 31 1 442 97 10 0 0 0 195 0 76 0 0 359 249 0 0 238 537 0 0 145 181 0 217 0 165 0 0 0 440 184 14 327 87 0 168 68 0 0 716 0 570 2 0 0 0 0 0 311 0 22 0 0 612 0 148 0 225 30 0 87 0 0 0 104 267 138 0 0 243 0 343 118 78 0 0 0 0 8 0 518 432 0 375 608 102 0 0 230 136 362 0 95 0 23 480 208 444 0 0 61 73 0 0 11 284 0 847 20 777 0 0 0 5 0 698 368 0 0 191 63 76 7 0 0 0 780 283 0 94 58 0 213 0 141 529 31 436 0 0 428 226 167 50 0 0 0 199 0 0 654 0 0 0 11 0 0 142 0 0 0 0 0 0 0 284 153 444 0 69 22 0 0 0 0 475 67 209 147 800 409 384 0 0 0 104 256 403 281 12 0 160 0 9 0 0 0 119 0 0 0 175 0 0 106 388 45 57 0 0 473 514 652 0 382 0 283 0 0 0 0 568 0 0 2 0 0 146 617 2 0 402 0 0 134 127 0 144 0 0 18 0 0 0 0 2 319 17 148 0 0 0 740 83 763 239 0 113 0 29 262 0 0 0 0 0 18 452 549 0 0 0 178 282 0 200 50 44 182 94 48 0 0 293 0 0 0 0 321 77 100 114 0 0 0 0 2 0 210 0 796 324 714 934 183 0 174 38 429 0 0 131 0 707 0 0 658 0 495 0 0 0 168 0 414 806 153 0 65 0 45 179 101 0 0 192 0 22 462 223 0 36 21 0 95 371 0 0 0 686 0 0 547 0 0 587 343 0 0 0 0 0 0 0 0 232 74 207 0 203 0 41 421 0 0 222 149 25 0 553 0 0 0 35 941 0 0 350 0 899 0 0 194 341 0 0 0 89 137 419 27 622 0 638 0 542 524 0 0 0 0 85 491 0 137 124 204 0 6 165 128 66 0 903 469 163 0 0 0 0 86 109 0 0 0 272 0 0 148 504 0 0 0 277 193 59 0 595 443 435 0 0 114 0 0 277 0 121 709 185 0 0 151 36 0 0 0 576 73 58 793 0 347 0 0 0 113 0 0 0 12 0 0 928 0 749 260 0 0 565 0 0 365 0 522 0 305 399 52 0 432 368 174 1083 639 0 10 158 0 0 0 269 0 101 20 193 440 0 0 261 469 0 415 0 454 125 0 0 0 0 236 0 0 17 0 0 838 0 0 645 0 168 0 351 0 145 208 336 1100 0 0 726 0 679 0 0 0 741 168 0 314 0 0 797 205 141 0 0 161 336 0 0 289 764 0 0 225 0 0 0 243 0 576 0 232 0 153 40 284 304 0 0 38 344 0 53 0 0 159 0 0 0 398 0 78 0 320 741 485 0 247 0 0 270 0 0 0 193 0 0 103 327 526 78 0 983 0 0 0 76 63 179 89 0 0 255 0 0 0 0 100 212 471 0 0 0 0 0 0 0 164 66 0 152 0 83 0 0 0 0 162 9 513 0 0 0 0 0 621 0 190 0 28 0 73 49 319 0 0 0 57 202 0 0 416 0 220 471 235 196 1018 354 452 0 1157 298 0 0 0 0 0 68 0 0 0 0 1006 671 95 119 201 96 0 758 0 0 782 170 0 0 0 16 0 0 213 0 0 294 0 162 0 4 357 369 0 8 465 0 686 0 226 0 0 253 0 0 0 53 0 1063 208 0 0 427 0 0 0 0 433 65 0 0 113 312 0 63 0 381 795 41 0 698 0 0 0 491 0 226 162 0 0 0 0 0 0 0 188 295 891 0 432 247 5 0 0 0 0 0 104 128 427 25 0 0 0 163 0 110 0 0 277 582 11 0 90 0 0 105 982 0 142 0 0 0 0 0 0 0 119 0 0 0 162 0 0 709 20 743 0 0 536 366 0 1161 75 442 532 310 0 0 79 0 0 0 428 0 519 0 0 331 0 0 583 0 0 368 0 0 0 453 166 154 0 0 0 868 0 0 0 264 0 579 0 0 0 0 0 588 96 0 0 534 283 26 177 0 101 388 898 16 9 324 0 61 244 0 401 52 110 134 0 0 499 12 0 1064 0 0 292 0 0 0 0 315 350 0 0 0 231 0 0 110 16 0 461 0 340 711 0 242 0 597 272 0 0 0 0 0 55 0 142 598 366 590 0 819 0 19 0 0 0 0 0 0 0 456 339 0 186 623 0 148 0 70 0 0 108 113 21 903 92 0 0 77 0 116 0 87 559 0 0 0 47 360 55 0 0 718 414 302 412 448 402 1353 0 0 0 0 21 39 0 140 0 0 0 0 0 0 0 301 197 0 310 48 0 0 0 35 80 0 181 616 233 15 382 551 520 494 0 0 0 56 0 0 0 731 0 0 0 145 0 0 0 171 0 119 0 0 0 694 0 1183 313 848 0 0 6 0 0 0 1 675 432 0 193 0 749 0 0 188 90 873 0 0 393 0 0 535 177 20 172 0 319 0 208 0 652 0 0 66 272 0 0 0 0 377 0 0 0 0 954 323 0 0 0 222 0 44 1007 94 0 0 0 0 0 376 339 0 527 41 263 885 0 407 61 706 0 94 0 180 0 379 179 636 619 0 452 97 602 0 223 0 0 0 752 162 209 113 152 182 0 0 231 604 0 14 108 577 0 0 0 0 546 0 66 0 0 270 34 0 917 3 383 0 0 119 1074 0 0 632 245 68 179 234 0 0 130 23 555 0 0 36 0 0 0 0 106 0 0 0 794 0 0 419 0 0 0 0 0 405 79 25 0 0 0 275 0 143 713 0 1117 0 0 752 64 0 218 58 0 0 65 1423 745 0 29 1311 41 0 0 0 0 0 0 0 525 672 0 833 0 0 0 11 1457 153 87 0 1081 631 0 0 290 146 256 57 0 0 0 271 0 0 824 718 762 197 0 0 514 332 319 0 388 0 1112 0 195 0 0 0 384 0 0 0 182 27 108 0 470 432 421 27 61 861 0 0 0 0 95 153 0 442 0 897 0 0 283 640 1103 6 85 40 104 386 984 0 268 538 83 0 1115 488 426 0 0 0 0 21 0 334 825 765 915 0 0 343 0 0 0 480 983 294 0 0 416 0 89 334 0 0 707 0 0 3 0 0 0 658 87 549 0 0 691 0 0 0 0 0 0 1005 806 0 170 0 63 0 0 130 0 213 371 0 115 2 0 0 332 0 395 0 0 0 0 130 0 421 1002 0 334 0 420 0 0 0 125 571 795 521 0 60 273 250 0 0 0 0 0 0 200 36 0 0 487 0 0 15 494 523 0 783 9 0 71 567 771 986 0 173 783 0 0 948 0 0 0 113 170 0 1045 0 38 368 750 0 143 12 237 0 0 1105 20 0 76 382 12 0 877 200 583 914 280 0 641 0 890 0 1315 596 367 114 0 544 19 422 54 103 70 0 0 162 0 164 389 0 123 111 183 0 382 0 351 0 0 0 582 0 622 126 287 87 90 0 144 0 0 116 0 0 0 0 384 478 360 0 0 322 485 0 0 523 0 37 652 301 0 755 463 0 753 406 0 274 158 0 0 214 0 0 0 157 81 0 0 0 942 0 0 0 0 0 168 0 0 466 851 336 413 99 407 1012 313 149 0 0 0 39 143 0 49 195 164 176 62 0 0 0 0 0 0 0 44 0 108 0 0 172 0 880 0 37 128 0 0 0 105 0 0 25 303 0 0 0 704 136 210 120 121 0 0 68 828 237 267 0 0 0 0 0 0 0 597 266 908 0 0 367 0 455 494 293 105 964 0 0 0 27 39 271 1110 284 0 630 508 245 246 598 1288 28 101 0 1193 32 442 0 0 430 38 0 676 337 0 808 93 587 0 1160 0 691 0 1409 7 0 0 109 13 650 0 0 190 0 68 0 0 0 0 0 0 191 0 127 0 1478 0 0 0 0 176 506 0 0 0 0 0 0 0 0 0 311 0 0 54 317 0 0 0 0 0 374 1128 894 90 0 307 0 1227 0 0 0 0 0 209 931 244 729 1157 870 0 107 14 437 72 137 0 0 242 0 0 38 1428 0 0 0 0 0 0 127 233 0 439 407 163 0 559 284 0 408 468 305 0 0 270 581 0 0 210 0 126 0 152 0 192 0 0 0 1222 253 0 176 0 0 0 0 0 0 0 0 0 541 35 0 0 160 0 787 148 418 0 0 0 501 0 0 1293 155 154 20 0 384 157 0 242 507 112 0 890 0 0 0 0 0 534 0 435 0 0 0 77 0 0 176 964 877 1162 0 829 97 0 0 860 0 0 146 0 53 0 0 0 367 0 1349 0 565 0 739 0 782 177 0 0 57 0 0 0 0 0 159 0 161 0 0 0 28 0 885 569 204 0 0 0 167 8 0 0 0 0 0 0 47 0 1043 800 610 0 19 1093 11 0 202 1527 683 0 30 21 0 0 0 180 841 121 0 0 0 0 809 0 610 448 172 0 0 174 0 0 15 423 0 26 0 0 80 7 0 110 0 181 0 0 0 592 0 402 0 683 289 11 0 599 0 0 0 0 0 189 0 186 0 763 1404 0 0 0 0 732 879 152 1474 134 133 0 0 345 472 504 5 0 0 774 0 0 1158 0 310 89 377 0 708 0 617 0 0 6 0 1055 0 196 0 0 0 0 0 208 493 447 264 0 135 0 0 0 0 0 0 0 0 325 1058 300 0 0 0 0 0 410 0 0 81 15 170 0 98 182 0 880 0 850 15 365 0 0 10 0 608 0 104 0 1132 5 852 57 0 0 173 527 153 0 0 0 106 0 685 0 0 0 490 1321 423 0 0 1324 697 0 64 0 152 0 400 261 200 756 648 0 428 550 0 115 51 735 1291 482 0 0 0 0 0 138 387 0 0 891 152 100 591 270 37 0 0 16 369 1366 0 221 277 0 6 0 524 0 95 0 1367 526 949 0 261 0 0 0 0 0 0 212 0 0 0 472 297 796 907 0 0 0 908 356 602 0 11 0 516 0 0 0 0 0 272 247 0 469 0 0 940 1152 0 0 0 305 0 1147 0 310 0 0 22 0 375 229 287 0 0 67 371 7 0 0 0 0 49 0 0 0 0 208 0 180 684 75 0 406 0 507 0 0 0 2 0 264 1000 604 488 230 0 555 0 0 413 0 0 14 0 203 183 39 0 0 79 0 227 208 0 0 0 0 754 0 1395 40 177 908 0 0 0 360 0 0 611 0 327 207 0 0 0 692 0 0 0 0 0 0 0 0 0 181 0 1386 95 0 0 1167 488 256 0 0 253 0 0 55 0 0 0 0 1040 8 0 289 122 411 0 0 0 267 384 0 0 60 405 25 762 184 0 591 0 0 0 967 0 903 82 0 0 789 0 111 19 34 0 0 0 0 0 0 0 0 17 0 0 576 0 0 0 412 0 295 179 213 0 154 693 0 372 62 0 0 0 906 0 336 0 134 301 0 0 747 85 0 989 0 0 1133 0 0 0 0 0 877 1202 23 0 0 0 0 0 1232 703 733 0 0 0 0 200 39 707 157 0 0 0 0 0 0 0 0 0 0 0 0 0 493 0 989 0 0 141 854 138 194 0 167 506 0 0 0 319 47 0 0 746 0 0 0 0 129 0 32 0 0 158 324 827 409 6 0 755 146 1134 507 583 692 649 0 0 1364 0 77 648 14 632 0 0 68 0 0 434 0 0 0 209 507 588 0 592 143 250 468 0 915 0 26 0 0 160 0 75 543 0 377 0 182 0 621 0 451 0 0 1319 1050 0 538 350 1002 910 0 779 582 0 326 0 620 0 52 17 0 0 0 479 0 42 602 0 329 255 0 0 0 0 791 955 0 0 0 48 0 0 447 0 252 121 0 0 221 0 66 42 139 1388 69 0 0 0 0 0 155 497 0 735 61 194 0 0 81 0 168 0 806 0 254 0 678 0 372 0 1526 175 0 706 482 0 980 0 0 0 92 0 325 260 1209 0 18 146 1110 646 0 0 0 1018 0 267 161 0 484 0 0 1050 0 0 1143 0 0 0 0 0 147 651 0 34 242 0 482 283 0 0 0 830 0 0 0 0 368 0 47 253 784 0 0 0 624 0 887 437 0 577 3 0 0 844 0 0 63 0 898 0 52 668 0 244 0 313 1050 1189 31 668 350 607 516 0 0 0 7 326 0 84 79 94 57 0 756 726 0 0 0 0 0 450 0 180 0 969 304 0 0 559 226 0 0 0 0 0 1162 0 0 400 8 0 608 0 0 1710 876 0 0 252 0 0 0 112 0 0 93 489 0 0 145 189 70 0 29 0 0 0 795 0 0 0 231 0 0 136 292 390 0 390 0 0 316 183 84 0 0 0 535 0 688 63 1127 0 0 0 0 226 0 823 0 993 1191 541 565 52 0 459 0 115 941 0 744 0 0 550 94 0 0 54 0 0 0 97 0 0 0 0 0 0 150 195 0 334 0 0 0 103 963 0 0 1078 0 0 0 225 22 0 160 695 0 0 0 61 553 0 166 1037 237 0 0 775 48 0 995 0 0 41 253 845 0 1404 407 61 409 0 241 0 395 358 0 1005 0 0 0 0 0 0 0 1325 0 0 334 0 295 1126 0 1117 0 453 387 0 363 203 440 0 167 0 1082 1321 605 34 0 0 567 622 0 0 0 474 0 275 0 445 0 448 0 0 0 57 951 804 450 1596 544 153 254 976 0 0 0 54 0 92 0 724 0 908 63 0 0 0 49 0 0 0 370 925 0 0 0 228 462 0 0 1467 1470 302 0 967 254 419 14 62 69 0 420 760 0 0 203 0 24 0 240 0 127 0 0 0 23 0 76 1006 0 593 37 0 0 0 663 613 0 0 346 168 0 0 0 205 0 220 0 0 0 0 0 0 63 880 0 279 0 0 249 243 0 0 0 0 1173 693 201 403 829 0 92 0 0 0 0 428 14 766 0 0 1022 0 521 627 0 0 451 0 763 0 0 0 0 310 850 316 0 530 862 0 0 0 829 0 0 0 0 0 691 278 0 0 0 0 0 100 0 741 0 1 58 490 336 341 742 503 720 0 1017 0 797 0 0 77 92 0 1273 267 41 1627 885 0 637 0 900 71 0 449 260 1000 0 616 0 746 1181 21 545 528 249 964 35 0 0 1461 0 1006 0 0 1227 0 1452 1000 583 579 720 64 0 575 316 0 84 0 0 84 272 0 417 89 0 1192 731 0 0 0 0 0 20 0 0 700 0 0 886 544 164 15 0 907 0 0 19 329 0 37 367 768 0 0 511 118 569 0 0 209 0 0 1259 572 339 0 778 341 0 0 0 874 1313 0 0 1060 416 98 167 1621 0 76 816 1124 0 0 0 0 17 1089 937 0 0 18 410 0 13 0 1275 517 203 53 178 1105 360 0 1318 86 197 0 0 32 0 620 200 0 1563 0 53 0 0 0 0 0 624 546 0 442 0 1524 688 0 0 0 1024 692 0 0 48 0 0 0 94 0 0 0 28 0 0 0 200 109 612 79 1261 0 434 1007 0 1025 0 211 0 687 1633 3 0 1179 943 73 130 0 0 970 236 418 0 16 0 814 0 315 0 399 989 0 40 0 0 0 510 0 0 187 85 149 438 0 0 0 0 0 36 0 1165 633 259 0 0 653 915 0 0 968 0 466 77 0 139 560 1068 144 263 1496 0 0 1464 0 263 0 0 419 0 13 291 158 486 894 0 0 0 146 138 0 0 0 764 639 419 106 0 136 0 0 0 0 0 474 30 526 0 9 664 1425 1072 0 263 110 45 0 309 0 0 654 376 0 0 338 0 0 0 0 838 33 0 0 0 247 922 0 0 0 0 949 496 1370 2 0 0 564 0 369 770 0 901 245 1356 36 366 139 511 0 176 431 0 0 0 457 1416 0 577 0 0 0 108 878 0 259 0 0 0 1350 433 0 1231 0 0 1086 0 1230 37 0 1029 0 127 0 484 0 0 0 103 222 0 0 0 0 375 57 0 0 460 0 1053 781 0 0 0 0 0 157 0 0 649 133 0 0 36 463 1063 1214 690 183 0 274 519 455 0 234 40 84 376 330 0 0 0 675 99 0 0 0 0 0 155 1464 0 0 0 421 0 0 0 87 1265 0 354 589 362 0 175 609 0 0 0 0 1320 0 774 325 0 0 0 771 3 857 0 0 0 0 270 0 421 0 652 0 117 787 0 365 0 18 0 0 1277 743 0 576 0 0 0 0 371 165 0 0 181 0 0 0 0 0 0 0 1145 431 290 34 0 0 0 0 0 0 0 0 281 74 0 313 0 374 0 0 0 664 833 299 0 0 342 0 0 189 0 0 485 194 0 0 0 1045 514 0 0 264 0 0 345 897 0 481 0 1266 0 0 209 0 1220 0 623 0 0 0 0 640 187 0 0 1196 0 0 670 1079 0 153 0 0 0 56 1501 0 0 0 521 711 0 1458 1497 0 0 913 0 1050 0 1240 516 216 0 2 0 1569 0 321 0 0 266 0 0 0 0 126 0 0 0 31 0 0 0 0 0 0 0 648 0 737 0 388 0 620 579 648 140 0 92 599 83 267 0 82 0 251 256 383 86 0 343 0 950 286 0 0 0 0 527 0 0 0 1612 1220 0 0 0 0 0 0 978 276 189 1299 414 0 669 347 0 1465 0 28 230 0 759 0 0 0 0 507 0 0 0 0 0 835 585 0 1218 209 0 61 0 0 0 0 119 0 182 0 0 0 0 294 805 0 0 0 649 291 403 164 0 489 0 387 0 578 211 0 474 774 371 800 494 0 0 75 30 162 0 0 0 0 0 0 744 0 0 0 612 472 537 0 0 1011 0 544 0 817 104 0 0 0 0 0 59 0 531 0 0 0 0 135 391 0 328 972 0 1073 23 593 439 1194 0 615 0 96 0 0 41 0 0 0 0 0 0 540 522 23 850 166 789 0 0 1458 0 550 752 11 0 0 0 320 295 713 0 695 17 0 193 306 100 0 0 64 15 0 392 720 0 480 1374 0 0 465 0 391 44 0 0 189 0 1245 0 0 929 463 0 0 0 76 0 376 20 0 235 834 324 1506 0 0 622 465 0 1556 189 23 0 170 0 0 66 451 323 206 887 146 101 0 0 0 1014 307 136 163 350 0 807 332 0 825 244 0 0 0 478 750 1450 0 0 211 268 1398 362 423 0 283 0 0 0 0 1311 1673 0 0 0 0 384 0 0 52 0 0 513 31 632 0 462 0 693 0 85 0 1151 526 0 0 0 0 0 0 0 85 531 0 427 0 0 0 446 1581 0 580 1436 1396 585 0 0 0 0 988 0 1394 0 0 0 0 395 897 0 223 0 466 0 317 0 0 864 0 0 0 440 521 867 0 0 243 1414 0 0 0 0 349 0 0 244 156 1405 317 1021 0 602 0 0 1278 1100 0 296 626 498 0 0 0 0 0 364 417 1214 1885 1220 143 0 1707 342 0 0 0 419 1022 1175 0 0 0 0 309 583 99 693 212 156 1125 0 375 990 0 0 79 520 0 0 705 0 199 535 0 136 307 1355 0 0 0 0 0 1113 189 246 849 0 0 0 0 942 0 0 614 0 0 26 0 0 0 295 0 1888 0 0 0 638 0 199 275 0 30 320 4 148 0 82 0 1340 316 700 46 0 0 1573 0 0 0 276 690 0 0 0 794 558 0 0 185 0 0 1202 0 0 207 1426 0 567 1790 941 305 355 1584 39 346 0 0 68 0 1145 133 0 359 300 0 314 1465 35 0 627 1359 1180 50 828 33 1006 0 0 0 418 0 1042 1296 131 0 117 830 0 0 1596 322 0 0 387 0 1213 772 1170 0 1440 0 0 264 0 0 0 0 0 1319 1018 0 0 258 0 9 0 265 0 0 928 0 0 0 0 606 396 22 0 161 1000 399 1108 0 1349 255 753 292 741 0 679 0 158 0 0 435 612 105 0 0 0 482 0 165 0 0 0 0 0 667 0 115 233 716 0 732 0 220 242 592 0 519 0 1736 1391 0 135 352 0 0 872 137 411 0 910 0 0 490 0 3 0 0 252 0 1039 682 0 0 458 0 7 0 201 0 360 0 269 0 876 1151 0 756 1131 0 68 487 137 557 0 0 442 242 843 378 119 0 627 343 378 164 0 0 19 0 0 847 0 574 675 0 654 74 31 0 1808 0 527 1318 23 725 0 0 174 0 0 1222 1174 453 0 239 683 291 0 919 1812 0 0 87 632 1214 0 0 498 0 1402 0 172 0 0 81 1000 471 0 556 0 0 0 1332 689 0 393 533 0 217 157 1034 279 720 792 1249 0 1138 0 325 452 1339 0 980 0 0 0 0 0 0 0 19 0 0 0 156 1114 1834 374 1430 0 0 859 0 425 1761 0 1129 0 0 0 104 634 0 1651 96 0 0 0 141 829 423 0 1705 172 0 0 961 123 1503 0 0 0 0 38 0 944 0 697 49 0 0 207 1572 0 393 538 0 467 41 0 0 0 0 1715 251 0 0 39 94 0 0 0 0 1104 0 0 0 21 0 499 0 1229 157 700 980 361 0 0 1624 0 739 1118 0 0 0 0 0 0 195 0 235 1053 0 1478 0 0 0 0 0 0 144 0 677 0 0 0 1111 0 1772 121 0 0 0 0 0 0 0 4 0 0 0 327 1048 0 0 0 185 1695 530 0 0 0 0 357 399 274 0 0 201 149 514 0 640 123 0 153 1035 841 0 0 1116 0 1393 583 124 0 0 0 1109 0 0 302 0 0 0 0 262 0 960 1173 0 493 0 0 0 0 0 272 35 0 165 196 0 0 0 1181 224 0 16 802 0 386 1217 0 250 1071 23 214 0 153 397 0 29 378 615 649 0 46 0 0 685 668 75 228 0 0 951 0 0 67 0 0 785 0 940 80 48 256 1565 0 0 211 0 0 64 447 0 0 0 496 1468 0 1298 0 0 0 0 0 621 1016 908 401 0 490 822 1608 0 0 0 0 332 673 618 0 0 0 764 0 25 1437 0 0 0 209 0 503 0 7 329 0 150 1033 0 305 0 0 0 48 360 0 0 0 0 0 285 1572 154 240 0 912 0 1904 0 0 1549 0 0 0 0 0 0 0 1497 0 404 0 0 0 0 0 1004 834 1693 920 36 537 702 75 0 0 0 0 103 850 0 840 205 227 1084 0 239 0 0 0 1239 1418 0 47 0 0 0 0 121 0 648 544 0 0 0 0 906 1201 0 0 538 0 432 451 0 0 354 255 42 604 0 0 280 0 243 1926 0 466 0 68 703 1363 2 1551 71 0 0 0 446 0 0 0 255 0 0 0 0 1326 422 1619 53 1011 0 0 0 0 0 0 0 1085 0 1607 0 224 292 0 0 21 259 51 0 212 1524 0 645 0 196 1468 451 238 500 908 0 0 510 0 0 0 1088 0 316 1151 0 559 3 1427 15 0 74 182 0 0 861 251 1410 73 0 133 0 22 0 343 0 0 913 342 298 335 467 0 0 0 537 969 388 1064 1096 0 276 142 0 74 836 0 0 1797 269 54 332 110 88 175 1515 142 141 0 0 0 1014 0 539 289 0 0 1206 0 0 293 0 1588 0 1357 1422 133 176 0 5 1144 169 0 0 383 498 0 26 0 0 97 1020 0 847 35 0 1043 0 32 0 128 0 0 0 0 62 0 0 26 375 0 158 114 0 0 41 0 1073 0 0 190 0 0 0 411 0 698 174 498 0 423 956 0 0 748 732 0 532 252 0 98 0 0 356 0 0 0 139 954 0 0 372 0 316 527 235 0 0 602 0 0 0 496 0 269 0 0 0 269 357 0 0 0 1138 0 111 0 107 1155 445 498 0 0 172 0 0 790 1562 0 0 0 0 617 0 0 0 237 1262 1307 345 492 1377 0 7 1096 33 955 0 0 0 0 0 238 1304 0 934 404 193 193 872 355 0 227 0 0 0 0 884 112 0 0 0 962 119 0 0 0 8 0 0 387 115 710 1232 57 705 0 745 0 132 193 0 809 0 0 0 0 0 0 25 0 0 0 0 0 684 0 0 265 0 40 1921 0 538 0 0 0 0 24 552 0 467 1036 0 0 0 1374 199 0 370 0 0 0 0 59 555 0 0 0 320 0 462 926 104 830 0 1444 392 0 122 404 0 831 426 26 1503 736 0 0 76 1169 173 0 0 1048 27 0 0 816 0 234 12 0 0 174 313 0 1160 0 0 0 1935 0 792 0 67 0 861 0 690 0 0 0 181 0 687 0 39 40 0 62 24 0 0 564 0 53 754 0 0 465 0 0 138 0 435 54 397 1099 687 440 0 0 0 754 575 0 161 0 0 300 487 0 0 0 0 0 158 0 0 320 851 1093 607 0 1102 0 539 0 0 0 0 144 248 1193 81 0 113 0 0 942 59 509 225 10 0 162 0 927 0 669 0 1774 0 0 0 617 0 0 0 0 132 0 0 0 136 0 38 0 0 0 0 785 624 103 113 0 903 0 55 512 2 1405 110 0 0 0 0 0 278 0 342 17 918 439 313 0 150 0 336 1595 822 0 746 0 80 0 1270 0 840 152 0 8 0 1581 0 394 477 776 699 1179 0 0 0 185 434 97 648 0 45 96 113 0 0 1401 0 131 0 1122 596 625 0 497 0 260 0 0 181 0 0 417 0 635 517 0 242 677 0 956 0 0 0 1303 81 271 1234 596 355 0 263 0 792 0 0 74 784 203 0 0 268 1294 0 0 0 4 302 0 851 0 26 406 191 0 0 0 0 0 0 0 470 0 965 0 675 1622 972 0 0 0 0 568 0 0 578 1139 0 0 0 1471 955 1242 0 0 141 0 0 789 0 0 0 0 0 1142 0 377 0 0 0 294 766 483 534 615 0 957 9 0 214 0 0 0 0 0 1153 0 1367 14 0 0 726 883 1102 361 433 1701 1196 1107 0 535 0 0 0 0 0 0 1026 0 1306 306 178 22 0 0 0 0 347 345 0 5 0 1313 76 382 479 0 0 0 0 951 1241 410 365 162 382 0 0 0 233 0 244 1237 0 132 0 0 380 79 862 26 0 189 0 690 0 0 0 970 490 304 0 259 94 0 0 0 222 174 739 235 0 0 0 0 1182 0 0 704 0 0 1128 1310 200 648 0 0 598 0 0 720 1088 475 959 0 0 171 1505 0 461 705 524 84 0 701 418 122 0 0 346 0 0 0 404 436 1042 0 35 0 563 0 879 99 160 369 0 1181 0 0 336 1958 0 634 0 0 865 266 877 656 0 121 907 650 0 0 0 93 729 202 1097 0 0 0 737 1446 0 345 1581 452 0 0 0 0 0 65 0 431 18 0 432 133 251 0 0 0 27 0 352 0 0 0 0 0 517 642 604 1385 0 74 972 954 861 0 0 703 131 0 530 0 41 0 142 529 0 0 149 0 0 0 0 0 941 0 1766 0 0 1169 466 272 1918 0 1216 547 181 751 6 0 0 713 1301 14 0 0 272 331 0 242 382 31 0 0 0 136 0 113 0 1467 0 0 581 0 0 0 0 819 584 1476 0 312 0 437 232 277 0 1120 0 0 0 761 301 0 170 365 0 0 0 366 261 0 0 406 0 0 2009 785 0 0 0 311 102 965 0 592 0 83 0 1061 0 0 403 0 0 529 0 0 0 0 0 0 272 0 0 0 77 977 0 0 538 696 570 529 1394 0 224 527 0 226 575 277 726 0 350 0 0 471 0 275 0 843 239 11 692 1199 260 0 0 0 0 975 0 1207 0 4 96 671 0 0 0 0 0 0 93 1901 0 677 0 0 0 717 29 582 1558 397 193 975 1528 0 890 32 431 720 451 42 0 34 0 260 1639 0 0 862 168 0 0 0 0 0 41 1168 0 0 0 793 1566 128 15 0 4 1372 0 0 0 1290 147 190 0 988 456 789 1225 503 182 444 665 602 0 0 0 1058 58 1172 538 0 0 1245 699 0 379 906 0 0 0 113 0 0 275 0 0 1557 927 1516 25 626 0 397 0 562 306 168 137 0 0 0 0 122 0 1102 1689 399 0 0 0 0 0 364 0 0 890 0 0 728 595 961 0 0 316 0 21 0 817 0 186 0 462 0 0 0 0 1606 949 0 16 96 0 0 0 194 427 0 871 0 1427 0 53 437 57 1573 0 725 0 415 0 0 1340 1037 60 330 0 0 0 0 92 0 0 0 0 0 1233 547 0 471 0 0 0 0 270 0 203 0 784 450 0 672 823 0 410 548 1226 0 1012 0 0 0 19 103 0 1679 0 0 0 188 159 18 1325 0 0 1470 0 647 0 525 328 615 542 0 41 1138 416 73 0 216 689 69 0 0 0 0 576 0 0 278 1149 304 0 0 200 0 0 0 266 0 178 0 0 129 0 75 9 0 0 0 130 146 375 0 0 367 0 0 1065 550 404 64 0 0 1394 214 0 0 0 7 71 1381 1229 1380 0 137 0 5 876 0 0 1045 0 631 0 189 390 0 229 639 0 510 0 0 1396 791 0 517 0 0 6 701 334 0 1198 0 256 494 0 359 0 0 0 156 0 0 601 0 157 36 861 774 522 0 0 0 0 873 0 1212 500 0 3 70 0 0 0 1037 0 213 610 822 414 0 0 241 0 0 0 0 1638 357 257 842 0 0 543 0 0 197 0 543 0 93 811 0 379 74 0 269 4 168 431 380 12 422 98 615 0 749 0 587 0 647 110 382 0 291 99 431 0 0 556 0 1694 295 370 225 1913 0 202 325 1611 0 0 312 0 194 786 0 0 0 0 0 0 949 962 523 0 0 0 0 50 0 0 114 570 177 1349 0 0 0 0 0 54 600 13 0 0 0 0 0 132 0 479 0 0 1246 0 0 0 0 0 0 0 534 0 0 204 0 1453 0 0 276 893 0 160 226 0 379 0 0 0 0 109 90 1045 782 0 0 0 550 997 0 0 0 366 0 739 0 607 0 0 0 0 1095 195 584 0 381 0 297 0 32 206 745 0 0 0 0 474 0 457 4 0 0 0 644 0 515 0 100 0 0 0 665 315 0 819 0 619 0 0 81 1714 81 0 0 0 1157 0 0 0 0 1210 0 312 1288 0 0 0 231 0 0 329 428 0 0 0 0 155 0 445 0 1162 0 0 240 873 630 770 215 1152 0 0 686 1183 1041 0 98 1180 0 0 0 0 0 0 133 0 0 346 1247 0 521 1111 1428 0 682 0 1165 0 0 57 159 255 494 217 0 1165 205 0 0 528 79 0 0 877 0 0 0 0 0 0 0 0 0 0 0 400 0 506 0 82 117 2102 87 1352 441 691 382 585 0 158 0 0 0 446 0 1436 0 1871 950 620 100 184 239 780 4 0 0 0 1097 526 0 0 0 0 256 728 0 269 0 183 1437 727 1253 973 279 0 69 0 909 0 947 0 760 0 0 0 608 90 132 0 643 0 0 0 717 1601 1361 73 570 0 0 228 106 144 0 0 0 1613 0 0 145 0 0 483 446 1464 662 0 0 0 1918 4 627 0 429 0 457 318 0 1506 111 0 0 0 447 668 61 0 1204 1588 490 0 248 0 0 0 35 383 573 442 814 0 674 832 299 0 0 1451 89 0 0 0 0 0 0 188 0 152 0 0 101 0 901 857 321 1388 210 0 336 616 0 402 751 620 239 0 1345 543 0 0 0 0 0 0 0 0 0 0 0 0 547 25 0 0 1102 713 0 0 1816 0 0 0 0 971 447 1010 0 0 912 51 614 372 0 0 466 1290 0 0 58 0 114 557 0 0 488 0 384 1579 0 280 727 0 0 370 0 1466 68 23 0 783 380 275 0 343 1452 205 433 53 903 0 1420 352 0 0 204 362 0 0 63 941 373 579 0 0 0 193 249 1178 917 0 0 792 424 1297 0 0 0 824 0 0 0 1094 0 1266 190 0 793 434 0 568 0 0 46 677 0 442 0 245 1556 937 104 1750 0 893 357 0 852 0 0 0 0 541 143 0 0 0 0 31 0 0 0 1215 0 0 721 1346 429 111 244 0 0 104 0 0 0 0 93 90 0 513 303 0 0 1533 0 761 23 1800 598 0 0 531 1397 0 0 0 169 56 1603 0 154 0 0 0 0 600 0 0 738 0 1 0 1346 0 0 0 0 0 0 0 0 1376 228 137 0 1441 14 600 0 153 0 757 0 321 0 0 0 0 0 0 0 0 0 0 694 1496 514 1468 0 1364 0 1457 0 34 877 0 0 0 570 0 0 1821 761 144 0 0 76 12 0 0 417 0 650 0 3 607 0 0 0 0 0 0 1140 32 0 44 78 0 694 408 1118 892 1196 644 1002 503 225 0 707 0 0 108 620 1215 0 0 0 122 0 47 0 468 713 0 660 0 394 186 0 724 0 0 0 0 0 892 0 181 1440 168 460 59 126 0 0 307 338 151 0 511 222 0 0 1234 0 0 0 0 1327 165 0 835 1881 844 263 614 434 150 1488 522 0 35 814 0 0 0 16 38 0 0 369 0 874 0 0 0 0 1063 122 0 0 0 0 0 0 137 0 0 301 0 0 0 933 0 0 272 0 0 0 240 0 0 1222 667 0 0 62 279 800 1721 0 516 0 0 0 0 0 0 315 0 0 1346 446 0 0 369 667 1456 0 0 0 920 489 0 0 0 900 0 344 1887 0 0 1177 109 0 660 451 608 0 0 0 36 1012 0 0 0 0 0 91 0 0 0 0 0 798 372 0 0 0 140 0 0 0 1693 47 0 0 0 0 1081 0 0 0 1055 1194 0 0 507 0 0 37 57 0 0 1681 0 0 0 0 0 808 0 41 0 1137 0 0 262 0 1080 0 343 0 136 0 682 0 592 149 375 0 0 857 1486 0 383 0 0 149 203 0 0 0 251 0 0 329 1453 58 0 208 0 409 32 0 1252 0 1252 372 0 0 0 0 0 0 0 0 520 0 596 235 0 0 261 0 0 0 0 0 252 72 1375 0 0 0 0 0 281 212 211 663 1094 0 0 404 0 0 0 0 0 462 386 0 79 72 0 623 0 233 0 0 637 0 0 0 0 33 0 0 883 213 0 0 0 35 442 0 1152 0 0 0 0 643 0 1189 641 341 758 0 1725 0 0 104 1302 0 124 1018 0 0 0 0 971 0 1848 0 0 764 0 0 
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include "augment.hpp"
+#include "tree.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// price level of an order book: ordered by price, summed by volume
+struct Level {
+    int price;
+    long volume;
+};
+
+struct By_price {
+    bool operator()(const Level &a, const Level &b) const { return a.price < b.price; }
+};
+
+struct Volume {
+    long operator()(const Level &level) const { return level.volume; }
+};
+
+/// concatenation is not commutative, so it shows the fold keeps key order
+struct Concat_augment {
+    using value_type = std::string;
+
+    static std::string identity() { return {}; }
+    static std::string lift(char key) { return std::string(1, key); }
+    static std::string combine(const std::string &a, const std::string &b) { return a + b; }
+};
+
+/// brute-force fold of a sorted map over [lo, hi]
+template <typename Augment>
+typename Augment::value_type expected(const std::map<int, int> &keys, int lo, int hi) {
+    auto result = Augment::identity();
+    for (auto it = keys.lower_bound(lo); it != keys.end() && it->first <= hi; ++it)
+        result = Augment::combine(result, Augment::lift(it->first));
+    return result;
+}
+
+template <typename Augment> void check_against_map() {
+    RB_tree::Augmented_tree<int, Augment> tree;
+    std::map<int, int> keys;
+    std::mt19937 gen(5);
+
+    for (int step = 0; step < 4000; ++step) {
+        const int key = static_cast<int>(gen() % 2000) - 1000;
+        if (gen() % 3 == 0) {
+            tree.erase(key);
+            keys.erase(key);
+        } else {
+            tree.insert(key);
+            keys[key];
+        }
+        if (step % 97 == 0) {
+            ASSERT_TRUE(tree.check_invariants());
+        }
+    }
+
+    for (int i = 0; i < 500; ++i) {
+        const int lo = static_cast<int>(gen() % 2200) - 1100;
+        const int hi = lo + static_cast<int>(gen() % 600) - 100;
+        ASSERT_EQ(tree.range_aggregate(lo, hi), expected<Augment>(keys, lo, hi));
+    }
+    EXPECT_EQ(tree.aggregate(), expected<Augment>(keys, std::numeric_limits<int>::min(),
+                                                  std::numeric_limits<int>::max()));
+}
+
+} // namespace
+
+TEST(AugmentTest, SumMinMaxMatchBruteForce) {
+    check_against_map<RB_tree::Sum_augment<long>>();
+    check_against_map<RB_tree::Min_augment<int>>();
+    check_against_map<RB_tree::Max_augment<int>>();
+}
+
+TEST(AugmentTest, CountIsTheDefaultAndAddsNoField) {
+    static_assert(std::is_same_v<RB_tree::Tree<int>::node_type, RB_tree::Node<int>>);
+
+    RB_tree::Tree<int> tree;
+    for (int i = 0; i < 100; ++i)
+        tree.insert(i * 2);
+    EXPECT_EQ(tree.range_aggregate(10, 20), tree.count_in_range(10, 20));
+    EXPECT_EQ(tree.range_aggregate(20, 10), 0u);
+    EXPECT_EQ(tree.aggregate(), 100u);
+}
+
+TEST(AugmentTest, VolumeBetweenPrices) {
+    RB_tree::Tree<Level, By_price, RB_tree::Arena_allocator<Level>,
+                  RB_tree::Sum_augment<long, Volume>>
+        book;
+    for (int price = 100; price < 200; ++price)
+        book.insert(Level{price, price % 7 + 1});
+
+    long volume = 0;
+    for (int price = 120; price <= 150; ++price)
+        volume += price % 7 + 1;
+    EXPECT_EQ(book.range_aggregate(Level{120, 0}, Level{150, 0}), volume);
+    EXPECT_EQ(book.range_aggregate(Level{300, 0}, Level{400, 0}), 0);
+}
+
+TEST(AugmentTest, FoldKeepsKeyOrder) {
+    RB_tree::Augmented_tree<char, Concat_augment> tree;
+    for (char c : std::string("qwertyuiopasdfghjklzxcvbnm"))
+        tree.insert(c);
+    tree.erase('m');
+
+    EXPECT_EQ(tree.range_aggregate('c', 'k'), "cdefghijk");
+    EXPECT_EQ(tree.aggregate(), "abcdefghijklnopqrstuvwxyz");
+    EXPECT_EQ(tree.range_aggregate('m', 'm'), "");
+    EXPECT_TRUE(tree.check_invariants());
+}
+
+TEST(AugmentTest, BulkBuildsKeepTheFold) {
+    std::vector<int> keys;
+    for (int i = 0; i < 1000; ++i)
+        keys.push_back((i * 37) % 1000);
+
+    RB_tree::Augmented_tree<int, RB_tree::Sum_augment<long>> tree;
+    tree.assign(keys);
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_EQ(tree.range_aggregate(10, 19), 145);
+
+    std::vector<int> more{1000, 1001, 1002};
+    tree.insert_batch(std::span<const int>(more));
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_EQ(tree.aggregate(), 999L * 1000 / 2 + 3003);
+
+    std::sort(keys.begin(), keys.end());
+    auto built = RB_tree::Augmented_tree<int, RB_tree::Max_augment<int>>::from_sorted(
+        keys.begin(), keys.end());
+    EXPECT_EQ(built.range_aggregate(-5, 500), 500);
+    EXPECT_EQ(built.range_aggregate(2000, 3000), std::numeric_limits<int>::lowest());
+}
+
+TEST(AugmentTest, SplitAndMergeKeepTheFold) {
+    RB_tree::Augmented_tree<int, RB_tree::Sum_augment<long>> tree;
+    for (int k = 1; k <= 1000; ++k)
+        tree.insert(k);
+
+    auto upper = tree.split(501);
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_TRUE(upper.check_invariants());
+    EXPECT_EQ(tree.aggregate(), 500L * 501 / 2);
+    EXPECT_EQ(upper.aggregate(), 1000L * 1001 / 2 - 500L * 501 / 2);
+
+    RB_tree::Augmented_tree<int, RB_tree::Sum_augment<long>> odd(tree.get_allocator());
+    for (int k = 1001; k <= 3000; k += 2)
+        odd.insert(k);
+    upper.merge(std::move(odd));
+    tree.join(std::move(upper));
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_EQ(tree.range_aggregate(999, 1003), 999L + 1000 + 1001 + 1003);
+}
+
+TEST(AugmentTest, ParallelBuildsKeepTheFold) {
+    RB_tree::Thread_pool pool(3);
+    std::vector<int> keys(100'000);
+    for (int i = 0; i < 100'000; ++i)
+        keys[static_cast<std::size_t>(i)] = 2 * i;
+
+    auto tree = RB_tree::Augmented_tree<int, RB_tree::Sum_augment<long>>::from_sorted(
+        keys.begin(), keys.end(), pool);
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_EQ(tree.aggregate(), 99'999L * 100'000);
+
+    for (auto &key : keys)
+        key += 1;
+    tree.insert_batch(std::span<const int>(keys.data(), 40'000), pool);
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_EQ(tree.range_aggregate(0, 9), 0L + 1 + 2 + 3 + 4 + 5 + 6 + 7 + 8 + 9);
+    EXPECT_EQ(tree.aggregate(), 99'999L * 100'000 + 39'999L * 40'000 + 40'000);
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include "bplus_tree.hpp"
+#include "eytzinger_index.hpp"
+#include "range_query.hpp"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+using RB_tree::BPlus_inner;
+using RB_tree::BPlus_leaf;
+using RB_tree::BPlus_tree;
+
+static_assert(sizeof(BPlus_leaf<int>) == RB_tree::bplus_node_bytes);
+static_assert(sizeof(BPlus_inner<int>) == RB_tree::bplus_node_bytes);
+static_assert(alignof(BPlus_leaf<int>) == RB_tree::cache_line_bytes);
+
+TEST(BPlusTreeTest, EmptyTree) {
+    BPlus_tree<int> tree;
+    EXPECT_TRUE(tree.empty());
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_EQ(tree.begin(), tree.end());
+    EXPECT_EQ(tree.lower_bound(3), tree.end());
+    EXPECT_EQ(tree.rank(3), 0u);
+    EXPECT_EQ(tree.count_in_range(1, 10), 0u);
+    EXPECT_EQ(tree.select(0), tree.end());
+    EXPECT_EQ(tree.erase(3), 0u);
+}
+
+TEST(BPlusTreeTest, SequentialInsertSplitsEveryLevel) {
+    BPlus_tree<int> tree;
+    for (int i = 0; i < 100000; ++i)
+        ASSERT_TRUE(tree.insert(i));
+    EXPECT_FALSE(tree.insert(500));
+    ASSERT_TRUE(tree.check_invariants());
+    EXPECT_EQ(tree.size(), 100000u);
+
+    int expected = 0;
+    for (int key : tree)
+        ASSERT_EQ(key, expected++);
+    EXPECT_EQ(*std::prev(tree.end()), 99999);
+    EXPECT_EQ(*tree.select(12345), 12345);
+    EXPECT_EQ(tree.count_in_range(-5, 49999), 50000u);
+}
+
+TEST(BPlusTreeTest, MatchesStdSetUnderInsertAndErase) {
+    std::mt19937 gen(16);
+    std::uniform_int_distribution<int> dist(-20000, 20000);
+
+    BPlus_tree<int> tree;
+    std::set<int> reference;
+    for (int round = 0; round < 4; ++round) {
+        // grow, then shrink below the size a single leaf holds, so every rebalance path runs
+        for (int i = 0; i < 30000; ++i) {
+            const int key = dist(gen);
+            ASSERT_EQ(tree.insert(key), reference.insert(key).second);
+        }
+        ASSERT_TRUE(tree.check_invariants());
+        while (reference.size() > 20) {
+            const int key = dist(gen);
+            ASSERT_EQ(tree.erase(key), reference.erase(key));
+        }
+        ASSERT_TRUE(tree.check_invariants());
+        ASSERT_EQ(tree.size(), reference.size());
+        ASSERT_TRUE(std::equal(tree.begin(), tree.end(), reference.begin(), reference.end()));
+    }
+
+    for (int i = 0; i < 20000; ++i) {
+        const int key = dist(gen);
+        tree.insert(key);
+        reference.insert(key);
+    }
+    ASSERT_TRUE(tree.check_invariants());
+
+    std::size_t k = 0;
+    for (int key : reference) {
+        ASSERT_EQ(*tree.select(k), key);
+        ASSERT_EQ(tree.rank(key), k);
+        ++k;
+    }
+    for (int i = 0; i < 2000; ++i) {
+        const int lo = dist(gen);
+        const int hi = dist(gen);
+        const auto expected =
+            lo <= hi ? std::distance(reference.lower_bound(lo), reference.upper_bound(hi)) : 0;
+        EXPECT_EQ(tree.count_in_range(lo, hi), static_cast<std::size_t>(expected));
+        if (lo <= hi) {
+            EXPECT_EQ(tree.log_distance(tree.lower_bound(lo), tree.upper_bound(hi)), expected);
+        }
+        EXPECT_EQ(RB_tree::range_query(tree, lo, hi), lo < hi ? expected : 0);
+    }
+}
+
+TEST(BPlusTreeTest, EraseDownToEmpty) {
+    BPlus_tree<int> tree;
+    for (int i = 0; i < 5000; ++i)
+        tree.insert(i * 7 % 5000);
+    for (int i = 0; i < 5000; ++i) {
+        ASSERT_EQ(tree.erase(i * 3 % 5000), 1u);
+        if (i % 500 == 0) {
+            ASSERT_TRUE(tree.check_invariants());
+        }
+    }
+    EXPECT_TRUE(tree.empty());
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_TRUE(tree.insert(1));
+    EXPECT_EQ(*tree.begin(), 1);
+}
+
+TEST(BPlusTreeTest, IteratorsWalkBothWays) {
+    BPlus_tree<int> tree;
+    for (int i = 0; i < 1000; ++i)
+        tree.insert(2 * i);
+
+    EXPECT_EQ(*tree.lower_bound(7), 8);
+    EXPECT_EQ(*tree.upper_bound(8), 10);
+    EXPECT_EQ(tree.upper_bound(1998), tree.end());
+
+    int expected = 1998;
+    for (auto it = tree.end(); it != tree.begin(); expected -= 2)
+        ASSERT_EQ(*--it, expected);
+    EXPECT_EQ(expected, -2);
+}
+
+TEST(BPlusTreeTest, CustomComparator) {
+    BPlus_tree<int, std::greater<int>> tree;
+    for (int i = 0; i < 500; ++i)
+        tree.insert(i);
+
+    EXPECT_EQ(*tree.begin(), 499);
+    EXPECT_EQ(tree.rank(400), 99u);
+    EXPECT_EQ(tree.count_in_range(300, 200), 101u);
+    EXPECT_TRUE(tree.check_invariants());
+}
+
+TEST(BPlusTreeTest, MoveTransfersTheKeys) {
+    BPlus_tree<int> tree;
+    for (int i = 0; i < 300; ++i)
+        tree.insert(i);
+
+    BPlus_tree<int> moved(std::move(tree));
+    EXPECT_EQ(moved.size(), 300u);
+    EXPECT_TRUE(tree.empty());
+    EXPECT_TRUE(tree.check_invariants());
+
+    tree = std::move(moved);
+    EXPECT_EQ(tree.size(), 300u);
+    EXPECT_TRUE(tree.check_invariants());
+}
+
+TEST(BPlusTreeTest, FreezesIntoEytzingerIndex) {
+    BPlus_tree<int> tree;
+    for (int i = 0; i < 1000; ++i)
+        tree.insert(i * 5);
+
+    RB_tree::Eytzinger_index<int> index(tree);
+    EXPECT_EQ(index.size(), 1000u);
+    EXPECT_EQ(index.count_in_range(0, 99), tree.count_in_range(0, 99));
+}
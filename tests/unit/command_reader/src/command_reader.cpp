@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "command_reader.hpp"
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using RB_tree::Command;
+using RB_tree::Command_reader;
+using RB_tree::Stream_reader;
+
+namespace {
+
+template <typename Reader> std::vector<Command> read_all(Reader &reader) {
+    std::vector<Command> commands;
+    Command cmd;
+    while (reader.next(cmd))
+        commands.push_back(cmd);
+    return commands;
+}
+
+/// feeds text through a pipe, so Command_reader has to use its block buffer
+std::vector<Command> read_through_pipe(const std::string &text) {
+    int fds[2];
+    EXPECT_EQ(pipe(fds), 0);
+    std::thread writer([&] {
+        for (std::size_t done = 0; done < text.size();) {
+            const auto n = write(fds[1], text.data() + done, text.size() - done);
+            if (n <= 0)
+                break;
+            done += static_cast<std::size_t>(n);
+        }
+        close(fds[1]);
+    });
+
+    Command_reader reader(fds[0]);
+    auto commands = read_all(reader);
+    writer.join();
+    close(fds[0]);
+    return commands;
+}
+
+/// writes text to a temporary file, so Command_reader maps it
+std::vector<Command> read_through_file(const std::string &text) {
+    std::FILE *file = std::tmpfile();
+    std::fwrite(text.data(), 1, text.size(), file);
+    std::fflush(file);
+
+    Command_reader reader(fileno(file));
+    auto commands = read_all(reader);
+    std::fclose(file);
+    return commands;
+}
+
+std::vector<Command> read_through_stream(const std::string &text) {
+    std::istringstream in(text);
+    Stream_reader reader(in);
+    return read_all(reader);
+}
+
+void expect_same(const std::vector<Command> &actual, const std::vector<Command> &expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(actual[i].op, expected[i].op);
+        EXPECT_EQ(actual[i].ok, expected[i].ok);
+        if (!expected[i].ok)
+            continue;
+        for (int a = 0; a < RB_tree::command_arity(expected[i].op); ++a)
+            EXPECT_EQ(actual[i].args[a], expected[i].args[a]);
+    }
+}
+
+} // namespace
+
+TEST(CommandReaderTest, ParsesIntegersLikeIostream) {
+    const std::string text = "k 0\nk -17\nk +42 k 2147483647 k -2147483648\n"
+                             "q 12345678 123456789\nq 1234567890 -99999999\n"
+                             "k 2147483648\nk 1\nq 1 x 3\ns 5\nz p 10 90\nk\n";
+    const auto expected = read_through_stream(text);
+    expect_same(read_through_pipe(text), expected);
+    expect_same(read_through_file(text), expected);
+
+    ASSERT_GE(expected.size(), 6u);
+    EXPECT_EQ(expected[5].args[1], 123456789);
+}
+
+TEST(CommandReaderTest, RecordsAcrossBlockBoundaries) {
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> dist(-1'000'000'000, 1'000'000'000);
+
+    std::string text;
+    while (text.size() < 3 * (1u << 20)) {
+        text += gen() % 3 ? "k " + std::to_string(dist(gen))
+                          : "q " + std::to_string(dist(gen)) + "   " + std::to_string(dist(gen));
+        text += gen() % 5 ? "\n" : " \t ";
+    }
+
+    const auto expected = read_through_stream(text);
+    expect_same(read_through_pipe(text), expected);
+    expect_same(read_through_file(text), expected);
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include "compact_tree.hpp"
+#include "range_query.hpp"
+#include "tree.hpp"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+using RB_tree::Color;
+using RB_tree::Compact_node;
+using RB_tree::Compact_tree;
+
+static_assert(sizeof(Compact_node<int>) == 20);
+
+TEST(CompactNodeTest, NilSentinelIsBlackAndEmpty) {
+    Compact_node<int> nil;
+    EXPECT_TRUE(nil.is_black());
+    EXPECT_EQ(nil.size(), 0u);
+    EXPECT_EQ(nil.get_left(), Compact_node<int>::nil);
+    EXPECT_EQ(nil.get_right(), Compact_node<int>::nil);
+}
+
+TEST(CompactNodeTest, ColorAndSizeShareOneWord) {
+    Compact_node<int> n(7, 0);
+    EXPECT_TRUE(n.is_red());
+    EXPECT_EQ(n.size(), 1u);
+
+    n.set_color(Color::black);
+    n.set_size(Compact_node<int>::max_size);
+    EXPECT_TRUE(n.is_black());
+    EXPECT_EQ(n.size(), Compact_node<int>::max_size);
+
+    n.set_color(Color::red);
+    EXPECT_EQ(n.size(), Compact_node<int>::max_size);
+    EXPECT_EQ(n.color(), Color::red);
+}
+
+TEST(CompactTreeTest, EmptyTree) {
+    Compact_tree<int> tree;
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.begin(), tree.end());
+    EXPECT_EQ(tree.lower_bound(5), tree.end());
+    EXPECT_EQ(tree.count_in_range(0, 10), 0u);
+}
+
+TEST(CompactTreeTest, RejectsDuplicates) {
+    Compact_tree<int> tree;
+    EXPECT_TRUE(tree.insert(3));
+    EXPECT_FALSE(tree.insert(3));
+    EXPECT_EQ(tree.size(), 1u);
+}
+
+TEST(CompactTreeTest, IteratesInOrder) {
+    Compact_tree<int> tree;
+    for (int k : {50, 10, 40, 20, 30})
+        tree.insert(k);
+
+    std::vector<int> keys(tree.begin(), tree.end());
+    EXPECT_EQ(keys, (std::vector<int>{10, 20, 30, 40, 50}));
+
+    auto it = tree.lower_bound(30);
+    EXPECT_EQ(*it, 30);
+    EXPECT_EQ(*--it, 20);
+}
+
+TEST(CompactTreeTest, MatchesPointerTree) {
+    Compact_tree<int> compact;
+    RB_tree::Tree<int> tree;
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> dist(0, 5000);
+
+    for (int i = 0; i < 3000; ++i) {
+        int k = dist(gen);
+        EXPECT_EQ(compact.insert(k), tree.insert(k));
+    }
+    EXPECT_TRUE(std::equal(compact.begin(), compact.end(), tree.begin(), tree.end()));
+
+    for (int i = 0; i < 2000; ++i) {
+        int lo = dist(gen), hi = dist(gen);
+        EXPECT_EQ(compact.count_in_range(lo, hi), tree.count_in_range(lo, hi));
+        EXPECT_EQ(RB_tree::range_query(compact, lo, hi), RB_tree::range_query(tree, lo, hi));
+        EXPECT_EQ(compact.log_distance(compact.lower_bound(lo), compact.upper_bound(hi)),
+                  tree.log_distance(tree.lower_bound(lo), tree.upper_bound(hi)));
+    }
+}
+
+TEST(CompactTreeTest, SortedInsertStaysCorrect) {
+    Compact_tree<int> tree;
+    for (int k = 0; k < 10000; ++k)
+        tree.insert(k);
+
+    EXPECT_EQ(tree.size(), 10000u);
+    EXPECT_EQ(tree.rank(5000), 5000u);
+    EXPECT_EQ(tree.count_in_range(100, 199), 100u);
+    EXPECT_EQ(*tree.begin(), 0);
+}
+
+TEST(CompactTreeTest, InsertKeepsInvariants) {
+    Compact_tree<int> tree;
+    for (int i = 0; i < 2000; ++i)
+        tree.insert((i * 7919) % 4001);
+    EXPECT_TRUE(tree.check_invariants());
+}
+
+TEST(CompactTreeTest, EraseMatchesPointerTree) {
+    Compact_tree<int> compact;
+    RB_tree::Tree<int> tree;
+    std::mt19937 gen(5);
+    std::uniform_int_distribution<int> dist(0, 2000);
+
+    for (int i = 0; i < 20000; ++i) {
+        int k = dist(gen);
+        if (gen() % 3 == 0)
+            EXPECT_EQ(compact.erase(k), tree.erase(k));
+        else
+            EXPECT_EQ(compact.insert(k), tree.insert(k));
+
+        if (i % 1000 == 0) {
+            ASSERT_TRUE(compact.check_invariants());
+        }
+    }
+    EXPECT_TRUE(compact.check_invariants());
+    EXPECT_EQ(compact.size(), tree.size());
+    EXPECT_TRUE(std::equal(compact.begin(), compact.end(), tree.begin(), tree.end()));
+    EXPECT_EQ(compact.count_in_range(100, 1500), tree.count_in_range(100, 1500));
+}
+
+TEST(CompactTreeTest, EraseIteratorReturnsNext) {
+    Compact_tree<int> tree;
+    for (int k : {1, 2, 3})
+        tree.insert(k);
+
+    auto it = tree.erase(tree.begin());
+    EXPECT_EQ(*it, 2);
+    EXPECT_EQ(*tree.begin(), 2);
+    EXPECT_EQ(tree.erase(tree.lower_bound(3)), tree.end());
+    EXPECT_EQ(tree.size(), 1u);
+}
+
+TEST(CompactTreeTest, SelectMatchesPointerTree) {
+    Compact_tree<int> compact;
+    RB_tree::Tree<int> tree;
+    for (int i = 0; i < 500; ++i) {
+        compact.insert((i * 31) % 977);
+        tree.insert((i * 31) % 977);
+    }
+    for (std::size_t k = 0; k <= tree.size(); ++k) {
+        if (k == tree.size())
+            EXPECT_EQ(compact.select(k), compact.end());
+        else
+            EXPECT_EQ(*compact.select(k), *tree.select(k));
+    }
+}
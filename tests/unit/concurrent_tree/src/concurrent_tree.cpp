@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "concurrent_tree.hpp"
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+using RB_tree::Concurrent_tree;
+
+TEST(ConcurrentTreeTest, MatchesStdSetOnOneThread) {
+    Concurrent_tree<int> tree;
+    std::set<int> reference;
+    std::mt19937 gen(3);
+    std::uniform_int_distribution<int> dist(0, 5000);
+
+    for (int i = 0; i < 3000; ++i) {
+        const int key = dist(gen);
+        EXPECT_EQ(tree.insert(key), reference.insert(key).second);
+    }
+
+    auto snapshot = tree.snapshot();
+    EXPECT_TRUE(snapshot.check_invariants());
+    ASSERT_EQ(snapshot.size(), reference.size());
+
+    std::size_t k = 0;
+    for (int key : reference) {
+        ASSERT_EQ(*snapshot.select(k), key);
+        EXPECT_EQ(snapshot.rank(key), k);
+        ++k;
+    }
+    EXPECT_EQ(snapshot.select(k), nullptr);
+
+    for (int i = 0; i < 500; ++i) {
+        int lo = dist(gen);
+        int hi = dist(gen);
+        auto lower = reference.lower_bound(lo);
+        auto upper = reference.upper_bound(lo);
+        EXPECT_EQ(snapshot.lower_bound(lo) ? *snapshot.lower_bound(lo) : -1,
+                  lower != reference.end() ? *lower : -1);
+        EXPECT_EQ(snapshot.upper_bound(lo) ? *snapshot.upper_bound(lo) : -1,
+                  upper != reference.end() ? *upper : -1);
+        const auto expected = lo <= hi ? std::distance(reference.lower_bound(lo),
+                                                       reference.upper_bound(hi))
+                                       : 0;
+        EXPECT_EQ(snapshot.count_in_range(lo, hi), static_cast<std::size_t>(expected));
+    }
+}
+
+TEST(ConcurrentTreeTest, SnapshotIgnoresLaterInserts) {
+    Concurrent_tree<int> tree;
+    for (int key = 0; key < 100; ++key)
+        tree.insert(key);
+
+    auto before = tree.snapshot();
+    for (int key = 100; key < 5000; ++key)
+        tree.insert(key);
+
+    EXPECT_EQ(before.size(), 100u);
+    EXPECT_EQ(before.count_in_range(0, 10'000), 100u);
+    EXPECT_TRUE(before.check_invariants());
+    EXPECT_EQ(tree.size(), 5000u);
+}
+
+TEST(ConcurrentTreeTest, RetiredNodesAreReclaimedWithoutReaders) {
+    Concurrent_tree<int> tree;
+    for (int key = 0; key < 20'000; ++key)
+        tree.insert(key);
+    // at most one batch below the reclaim threshold may still wait
+    EXPECT_LT(tree.retired_count(), 1024u + 64u);
+}
+
+// one writer inserts while readers check that every snapshot is a valid tree holding a prefix
+// of the insertion order, and that what they see never shrinks
+TEST(ConcurrentTreeTest, ReadersSeeConsistentSnapshotsDuringInserts) {
+    constexpr int n = 20'000;
+    std::vector<int> order(n);
+    for (int i = 0; i < n; ++i)
+        order[i] = i;
+    std::shuffle(order.begin(), order.end(), std::mt19937(5));
+    std::vector<std::size_t> inserted_at(n);
+    for (int i = 0; i < n; ++i)
+        inserted_at[order[i]] = i;
+
+    Concurrent_tree<int> tree;
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+
+    auto reader = [&](unsigned seed) {
+        std::mt19937 gen(seed);
+        std::size_t last_size = 0;
+        while (!done.load(std::memory_order_acquire)) {
+            auto snapshot = tree.snapshot();
+            const auto size = snapshot.size();
+            if (size < last_size)
+                ++failures;
+            last_size = size;
+
+            if (snapshot.count_in_range(0, n) != size)
+                ++failures;
+            for (std::size_t i = 0; i < size && i < (1u << 20); i += 1 + gen() % 997) {
+                const auto *key = snapshot.select(i);
+                if (!key || snapshot.rank(*key) != i || inserted_at[*key] >= size)
+                    ++failures;
+            }
+            if (gen() % 64 == 0 && !snapshot.check_invariants())
+                ++failures;
+        }
+    };
+
+    std::vector<std::thread> readers;
+    for (unsigned i = 0; i < 3; ++i)
+        readers.emplace_back(reader, i);
+
+    for (int key : order)
+        tree.insert(key);
+    done.store(true, std::memory_order_release);
+    for (auto &t : readers)
+        t.join();
+
+    EXPECT_EQ(failures.load(), 0);
+    auto snapshot = tree.snapshot();
+    EXPECT_EQ(snapshot.size(), static_cast<std::size_t>(n));
+    EXPECT_TRUE(snapshot.check_invariants());
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "eytzinger_index.hpp"
+#include "range_query.hpp"
+#include "tree.hpp"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+using RB_tree::Eytzinger_index;
+
+TEST(EytzingerIndexTest, EmptyIndex) {
+    Eytzinger_index<int> index;
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.rank(5), 0u);
+    EXPECT_EQ(index.upper_rank(5), 0u);
+    EXPECT_EQ(index.count_in_range(1, 10), 0u);
+}
+
+TEST(EytzingerIndexTest, RanksMatchSortedArrayAtEverySize) {
+    // every size up to 70 covers complete, almost complete and one-past-complete shapes
+    for (int n = 0; n <= 70; ++n) {
+        std::vector<int> keys(n);
+        for (int i = 0; i < n; ++i)
+            keys[i] = 2 * i;
+        Eytzinger_index<int> index(keys.begin(), keys.size());
+        ASSERT_EQ(index.size(), static_cast<std::size_t>(n));
+
+        for (int key = -1; key <= 2 * n; ++key) {
+            const auto lower = std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+            const auto upper = std::upper_bound(keys.begin(), keys.end(), key) - keys.begin();
+            ASSERT_EQ(index.rank(key), static_cast<std::size_t>(lower));
+            ASSERT_EQ(index.upper_rank(key), static_cast<std::size_t>(upper));
+        }
+    }
+}
+
+TEST(EytzingerIndexTest, FreezesTreeAndMatchesCountInRange) {
+    std::mt19937 gen(15);
+    std::uniform_int_distribution<int> dist(-100000, 100000);
+
+    RB_tree::Tree<int> tree;
+    std::set<int> reference;
+    for (int i = 0; i < 20000; ++i) {
+        const int key = dist(gen);
+        tree.insert(key);
+        reference.insert(key);
+    }
+
+    Eytzinger_index<int> index(tree);
+    ASSERT_EQ(index.size(), reference.size());
+    for (int i = 0; i < 2000; ++i) {
+        const int lo = dist(gen);
+        const int hi = dist(gen);
+        const auto expected =
+            lo <= hi ? std::distance(reference.lower_bound(lo), reference.upper_bound(hi)) : 0;
+        EXPECT_EQ(index.count_in_range(lo, hi), static_cast<std::size_t>(expected));
+        EXPECT_EQ(index.count_in_range(lo, hi), tree.count_in_range(lo, hi));
+    }
+}
+
+TEST(EytzingerIndexTest, CustomComparator) {
+    std::set<int, std::greater<int>> reference = {9, 7, 5, 3, 1};
+    Eytzinger_index<int, std::greater<int>> index(reference);
+
+    EXPECT_EQ(index.rank(7), 1u);
+    EXPECT_EQ(index.upper_rank(7), 2u);
+    EXPECT_EQ(index.count_in_range(8, 2), 3u);
+    EXPECT_EQ(index.count_in_range(2, 8), 0u);
+}
+
+TEST(EytzingerIndexTest, AnswersQueryRuns) {
+    std::vector<int> keys;
+    for (int i = 0; i < 1000; ++i)
+        keys.push_back(3 * i);
+    Eytzinger_index<int> index(keys.begin(), keys.size());
+
+    const std::vector<std::pair<int, int>> queries = {{0, 2}, {0, 3}, {-5, 5000}, {10, 1}};
+    std::vector<long> results(queries.size());
+    RB_tree::Thread_pool pool(1);
+    RB_tree::range_query_run(index, std::span<const std::pair<int, int>>(queries),
+                             std::span<long>(results), pool);
+    EXPECT_EQ(results, (std::vector<long>{1, 2, 1000, 0}));
+}
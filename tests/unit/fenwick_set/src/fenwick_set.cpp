@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include "fenwick_set.hpp"
+#include "range_query.hpp"
+#include <iterator>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using RB_tree::Fenwick_set;
+
+TEST(FenwickSetTest, MatchesStdSetUnderInsertAndErase) {
+    std::mt19937 gen(8);
+    std::uniform_int_distribution<int> dist(-3000, 3000);
+
+    std::vector<int> universe(2000);
+    for (auto &key : universe)
+        key = dist(gen);
+
+    Fenwick_set<int> set(universe);
+    std::set<int> reference;
+    for (int i = 0; i < 5000; ++i) {
+        const int key = universe[gen() % universe.size()];
+        if (gen() % 3 == 0)
+            EXPECT_EQ(set.erase(key), reference.erase(key));
+        else
+            EXPECT_EQ(set.insert(key), reference.insert(key).second);
+    }
+    ASSERT_EQ(set.size(), reference.size());
+
+    std::size_t k = 0;
+    for (int key : reference) {
+        ASSERT_EQ(*set.select(k), key);
+        EXPECT_EQ(set.rank(key), k);
+        ++k;
+    }
+    EXPECT_EQ(set.select(k), nullptr);
+
+    for (int i = 0; i < 1000; ++i) {
+        const int lo = dist(gen);
+        const int hi = dist(gen);
+        const auto expected =
+            lo <= hi ? std::distance(reference.lower_bound(lo), reference.upper_bound(hi)) : 0;
+        EXPECT_EQ(set.count_in_range(lo, hi), static_cast<std::size_t>(expected));
+    }
+}
+
+TEST(FenwickSetTest, KeysOutsideTheUniverse) {
+    Fenwick_set<int> set({5, 1, 3, 3, 9});
+    EXPECT_EQ(set.universe_size(), 4u);
+    EXPECT_THROW(set.insert(4), std::out_of_range);
+    EXPECT_EQ(set.erase(4), 0u);
+
+    set.insert(3);
+    set.insert(9);
+    EXPECT_EQ(set.count_in_range(2, 100), 2u);
+    EXPECT_EQ(*RB_tree::percentile_range(set, 0, 100).second, 9);
+}
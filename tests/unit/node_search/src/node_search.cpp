@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "bplus_tree.hpp"
+#include "node_search.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+using RB_tree::Isa;
+namespace node_search = RB_tree::node_search;
+
+namespace {
+
+bool supported(Isa isa) { return isa <= RB_tree::detect_isa(); }
+
+/// every kernel level against std::lower_bound/upper_bound for every node size up to 70
+template <typename KeyT> void check_all_sizes(Isa isa) {
+    std::mt19937 gen(17);
+    for (std::size_t n = 0; n <= 70; ++n) {
+        std::vector<KeyT> keys(n);
+        for (auto &key : keys)
+            key = static_cast<KeyT>(gen() % 1000) - 500;
+        std::sort(keys.begin(), keys.end());
+        // the kernels count every key, so a sorted node with repeats must still work
+        for (KeyT key = -502; key <= 502; ++key) {
+            const auto lower = std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+            const auto upper = std::upper_bound(keys.begin(), keys.end(), key) - keys.begin();
+            ASSERT_EQ(node_search::count<true>(isa, keys.data(), n, key),
+                      static_cast<std::size_t>(lower));
+            ASSERT_EQ(n - node_search::count<false>(isa, keys.data(), n, key),
+                      static_cast<std::size_t>(upper));
+        }
+    }
+}
+
+} // namespace
+
+static_assert(RB_tree::Counting_searchable<int, std::less<int>>);
+static_assert(RB_tree::Counting_searchable<double, std::less<>>);
+static_assert(!RB_tree::Counting_searchable<int, std::greater<int>>);
+static_assert(RB_tree::Vector_searchable<std::int64_t>);
+static_assert(!RB_tree::Vector_searchable<unsigned>);
+
+TEST(NodeSearchTest, DetectedLevelIsSupported) {
+    EXPECT_EQ(RB_tree::node_search_isa, RB_tree::detect_isa());
+}
+
+TEST(NodeSearchTest, ScalarKernel) {
+    check_all_sizes<std::int32_t>(Isa::scalar);
+    check_all_sizes<std::int64_t>(Isa::scalar);
+}
+
+TEST(NodeSearchTest, Sse42Kernel) {
+    if (!supported(Isa::sse42))
+        GTEST_SKIP();
+    check_all_sizes<std::int32_t>(Isa::sse42);
+    check_all_sizes<std::int64_t>(Isa::sse42);
+}
+
+TEST(NodeSearchTest, Avx2Kernel) {
+    if (!supported(Isa::avx2))
+        GTEST_SKIP();
+    check_all_sizes<std::int32_t>(Isa::avx2);
+    check_all_sizes<std::int64_t>(Isa::avx2);
+}
+
+TEST(NodeSearchTest, ExtremeBounds) {
+    constexpr auto min = std::numeric_limits<int>::min();
+    constexpr auto max = std::numeric_limits<int>::max();
+    const std::vector<int> keys = {min, min, -1, 0, 1, max, max, max, max};
+    const auto n = keys.size();
+
+    for (auto isa : {Isa::scalar, Isa::sse42, Isa::avx2}) {
+        if (!supported(isa))
+            continue;
+        EXPECT_EQ(node_search::count<true>(isa, keys.data(), n, min), 0u);
+        EXPECT_EQ(node_search::count<true>(isa, keys.data(), n, max), 5u);
+        EXPECT_EQ(n - node_search::count<false>(isa, keys.data(), n, max), n);
+        EXPECT_EQ(n - node_search::count<false>(isa, keys.data(), n, min), 2u);
+    }
+}
+
+TEST(NodeSearchTest, OtherKeysAndComparators) {
+    const std::vector<double> reals = {0.5, 1.5, 2.5, 3.5};
+    EXPECT_EQ(RB_tree::node_lower_count(reals.data(), reals.size(), 2.5, std::less<double>()), 2u);
+    EXPECT_EQ(RB_tree::node_upper_count(reals.data(), reals.size(), 2.5, std::less<double>()), 3u);
+
+    const std::vector<unsigned> naturals = {1, 3, 5, 7, 4000000000u};
+    EXPECT_EQ(RB_tree::node_lower_count(naturals.data(), naturals.size(), 3000000000u,
+                                        std::less<unsigned>()),
+              4u);
+
+    const std::vector<int> descending = {9, 7, 5, 3};
+    EXPECT_EQ(RB_tree::node_lower_count(descending.data(), descending.size(), 6,
+                                        std::greater<int>()),
+              2u);
+    EXPECT_EQ(RB_tree::node_upper_count(descending.data(), descending.size(), 7,
+                                        std::greater<int>()),
+              2u);
+}
+
+TEST(NodeSearchTest, BPlusTreeOfInt64Keys) {
+    RB_tree::BPlus_tree<std::int64_t> tree;
+    for (std::int64_t i = 0; i < 10000; ++i)
+        tree.insert(i * 1'000'000'007);
+    ASSERT_TRUE(tree.check_invariants());
+    EXPECT_EQ(tree.rank(5000 * 1'000'000'007LL), 5000u);
+    EXPECT_EQ(tree.count_in_range(1, 100 * 1'000'000'007LL), 100u);
+}
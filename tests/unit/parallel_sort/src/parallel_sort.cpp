@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include "parallel_sort.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+using RB_tree::Thread_pool;
+
+TEST(ParallelSortTest, SortsEverySizeAndPoolSize) {
+    std::mt19937 gen(1);
+    for (std::size_t threads : {1u, 2u, 3u, 8u}) {
+        Thread_pool pool(threads);
+        for (std::size_t n : {0u, 1u, 4095u, 10'000u, 100'003u}) {
+            std::vector<int> keys(n);
+            for (auto &key : keys)
+                key = static_cast<int>(gen() % 5000); // many repeats
+            auto expected = keys;
+            std::sort(expected.begin(), expected.end());
+
+            RB_tree::parallel_sort(std::span<int>(keys), std::less<int>(), pool);
+            ASSERT_EQ(keys, expected) << threads << " threads, " << n << " keys";
+        }
+    }
+}
+
+TEST(ParallelSortTest, SortsWithCustomComparator) {
+    Thread_pool pool(4);
+    std::vector<std::string> keys;
+    for (int i = 0; i < 30'000; ++i)
+        keys.push_back(std::to_string(i * 7919 % 30'000));
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+
+    RB_tree::parallel_sort(std::span<std::string>(keys), std::greater<>(), pool);
+    EXPECT_EQ(keys, expected);
+}
+
+TEST(ParallelSortTest, MergeOfSkewedInputs) {
+    Thread_pool pool(4);
+    std::vector<int> a(50'000);
+    std::vector<int> b(3);
+    for (std::size_t i = 0; i < a.size(); ++i)
+        a[i] = static_cast<int>(i / 2);
+    b = {-1, 100, 100};
+    std::vector<int> out(a.size() + b.size());
+    RB_tree::parallel_merge(std::span<const int>(a), std::span<const int>(b), std::span<int>(out),
+                            std::less<int>(), pool);
+
+    std::vector<int> expected;
+    std::merge(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+    EXPECT_EQ(out, expected);
+
+    RB_tree::parallel_merge(std::span<const int>(b), std::span<const int>(a), std::span<int>(out),
+                            std::less<int>(), pool);
+    EXPECT_EQ(out, expected);
+}
+
+TEST(ParallelSortTest, UniqueAndStrictlySorted) {
+    Thread_pool pool(3);
+    std::vector<int> keys(60'000);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        keys[i] = static_cast<int>(i / 3);
+    EXPECT_FALSE(
+        RB_tree::parallel_is_strictly_sorted(keys.begin(), keys.end(), std::less<int>(), pool));
+
+    const auto distinct =
+        RB_tree::parallel_unique(keys.begin(), keys.end(), std::less<int>(), pool);
+    ASSERT_EQ(distinct.size(), 20'000u);
+    for (std::size_t i = 0; i < distinct.size(); ++i)
+        ASSERT_EQ(distinct[i], static_cast<int>(i));
+    EXPECT_TRUE(RB_tree::parallel_is_strictly_sorted(distinct.begin(), distinct.end(),
+                                                     std::less<int>(), pool));
+
+    // a repeat right at the border of two pieces
+    std::vector<int> border(40'000);
+    for (std::size_t i = 0; i < border.size(); ++i)
+        border[i] = static_cast<int>(i);
+    border[20'000] = border[19'999];
+    EXPECT_FALSE(
+        RB_tree::parallel_is_strictly_sorted(border.begin(), border.end(), std::less<int>(), pool));
+}
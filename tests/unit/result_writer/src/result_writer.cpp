@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "result_writer.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+using RB_tree::Result_writer;
+
+namespace {
+
+/// everything written to file so far
+std::string contents(std::FILE *file) {
+    std::string text;
+    std::rewind(file);
+    for (int c; (c = std::fgetc(file)) != EOF;)
+        text.push_back(static_cast<char>(c));
+    return text;
+}
+
+} // namespace
+
+TEST(ResultWriterTest, TextMatchesStreamFormatting) {
+    std::FILE *file = std::tmpfile();
+    {
+        Result_writer out(fileno(file));
+        out.put(0);
+        out.put(42);
+        out.put(-7);
+        out.put(std::numeric_limits<std::int64_t>::min());
+        std::vector<long> counts{1, 22, 333};
+        out.put(std::span<const long>(counts));
+        out.finish();
+        EXPECT_TRUE(out.good());
+    }
+    EXPECT_EQ(contents(file), "0 42 -7 -9223372036854775808 1 22 333 \n");
+    std::fclose(file);
+}
+
+TEST(ResultWriterTest, LongOutputSpansSeveralFlushes) {
+    std::FILE *file = std::tmpfile();
+    std::string expected;
+    {
+        Result_writer out(fileno(file));
+        for (int i = 0; i < 100'000; ++i) {
+            out.put(i * 37);
+            expected += std::to_string(i * 37) + ' ';
+        }
+        out.finish();
+    }
+    EXPECT_EQ(contents(file), expected + '\n');
+    std::fclose(file);
+}
+
+TEST(ResultWriterTest, BinaryIsLittleEndianInt64) {
+    std::FILE *file = std::tmpfile();
+    {
+        Result_writer out(fileno(file), Result_writer::Mode::binary);
+        out.put(1);
+        out.put(-2);
+        out.put(0x0102030405060708);
+        out.finish();
+    }
+    const std::string bytes = contents(file);
+    ASSERT_EQ(bytes.size(), 24u);
+    EXPECT_EQ(bytes.substr(0, 8), std::string("\x01\0\0\0\0\0\0\0", 8));
+    EXPECT_EQ(bytes.substr(8, 8), std::string(8, '\xFF').replace(0, 1, "\xFE"));
+    EXPECT_EQ(bytes.substr(16, 8), "\x08\x07\x06\x05\x04\x03\x02\x01");
+    std::fclose(file);
+}
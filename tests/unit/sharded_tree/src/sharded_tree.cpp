@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include "range_query.hpp"
+#include "sharded_tree.hpp"
+#include "spsc_queue.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using RB_tree::Sharded_tree;
+using RB_tree::Spsc_queue;
+
+TEST(SpscQueueTest, DeliversEveryItemInOrder) {
+    Spsc_queue<int> queue(100);
+    EXPECT_EQ(queue.capacity(), 128u);
+
+    constexpr int n = 1'000'000;
+    std::thread producer([&] {
+        std::vector<int> items(37);
+        for (int next = 0; next < n;) {
+            const auto count =
+                std::min<std::size_t>(items.size(), static_cast<std::size_t>(n - next));
+            std::iota(items.begin(), items.begin() + static_cast<long>(count), next);
+            std::span<const int> rest(items.data(), count);
+            while (!rest.empty()) {
+                rest = rest.subspan(queue.push(rest));
+                std::this_thread::yield();
+            }
+            next += static_cast<int>(count);
+        }
+    });
+
+    std::vector<int> out(50);
+    for (int expected = 0; expected < n;) {
+        const auto count = queue.pop(out);
+        for (std::size_t i = 0; i < count; ++i)
+            ASSERT_EQ(out[i], expected++);
+        if (count == 0)
+            std::this_thread::yield();
+    }
+    producer.join();
+    EXPECT_EQ(queue.pop(out), 0u);
+}
+
+TEST(ShardedTreeTest, MatchesStdSetAcrossBatchesAndErases) {
+    for (std::size_t shards : {1u, 2u, 4u, 7u}) {
+        Sharded_tree<int> tree(shards);
+        std::set<int> expected;
+        std::mt19937 gen(static_cast<unsigned>(shards));
+        std::uniform_int_distribution<int> dist(0, 200'000);
+
+        for (std::size_t batch : {5000u, 10u, 3000u, 700u, 20'000u}) {
+            std::vector<int> keys(batch);
+            for (auto &key : keys)
+                key = dist(gen);
+            std::size_t added = 0;
+            for (int key : keys)
+                added += expected.insert(key).second;
+            EXPECT_EQ(tree.insert_batch(keys), added);
+
+            for (int i = 0; i < 300; ++i) {
+                const int key = dist(gen);
+                EXPECT_EQ(tree.erase(key), expected.erase(key));
+                const int fresh = dist(gen);
+                EXPECT_EQ(tree.insert(fresh), expected.insert(fresh).second);
+            }
+            ASSERT_TRUE(tree.check_invariants());
+            ASSERT_EQ(tree.size(), expected.size());
+
+            for (int i = 0; i < 500; ++i) {
+                const int lo = dist(gen);
+                const int hi = lo + dist(gen) / (1 + i % 5);
+                const auto count =
+                    std::distance(expected.lower_bound(lo), expected.upper_bound(hi));
+                ASSERT_EQ(tree.count_in_range(lo, hi), static_cast<std::size_t>(count));
+                ASSERT_EQ(tree.rank(lo),
+                          static_cast<std::size_t>(std::distance(expected.begin(),
+                                                                 expected.lower_bound(lo))));
+            }
+            for (std::size_t k = 0; k < expected.size(); k += 997)
+                ASSERT_EQ(*tree.select(k), *std::next(expected.begin(), static_cast<long>(k)));
+            EXPECT_EQ(tree.select(expected.size()), nullptr);
+        }
+    }
+}
+
+TEST(ShardedTreeTest, BoundsComeFromTheFirstBatch) {
+    Sharded_tree<int> tree(4);
+    std::vector<int> keys(100'000);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(3));
+    EXPECT_EQ(tree.insert_batch(keys), keys.size());
+
+    ASSERT_EQ(tree.bounds().size(), 3u);
+    for (std::size_t i = 0; i < 4; ++i) {
+        EXPECT_GT(tree.shard_size(i), 20'000u);
+        EXPECT_LT(tree.shard_size(i), 30'000u);
+    }
+    EXPECT_TRUE(tree.check_invariants());
+}
+
+TEST(ShardedTreeTest, SkewedGrowthRedrawsTheBounds) {
+    Sharded_tree<int> tree(4);
+    std::vector<int> keys(10'000);
+    std::iota(keys.begin(), keys.end(), 0);
+    tree.insert_batch(keys);
+
+    // every later key lands in the last shard until the bounds are redrawn
+    for (int round = 1; round <= 8; ++round) {
+        std::iota(keys.begin(), keys.end(), round * 10'000);
+        tree.insert_batch(keys);
+        ASSERT_TRUE(tree.check_invariants());
+        for (std::size_t i = 0; i < tree.shard_count(); ++i)
+            EXPECT_LE(2 * tree.shard_count() * tree.shard_size(i), 3 * tree.size());
+    }
+    EXPECT_EQ(tree.size(), 90'000u);
+    EXPECT_EQ(tree.count_in_range(-5, 100'000), 90'000u);
+    EXPECT_EQ(tree.count_in_range(15'000, 64'999), 50'000u);
+    EXPECT_EQ(*tree.select(77'777), 77'777);
+}
+
+TEST(ShardedTreeTest, QueryRunAcrossThePool) {
+    Sharded_tree<int> tree(3);
+    RB_tree::Tree<int> reference;
+    std::mt19937 gen(8);
+    std::uniform_int_distribution<int> dist(0, 1'000'000);
+    std::vector<int> keys(50'000);
+    for (auto &key : keys)
+        key = dist(gen);
+    tree.insert_batch(keys);
+    reference.insert_batch(keys);
+
+    std::vector<std::pair<int, int>> queries(20'000);
+    for (auto &[lo, hi] : queries) {
+        lo = dist(gen);
+        hi = dist(gen);
+    }
+    std::vector<long> sharded(queries.size());
+    std::vector<long> single(queries.size());
+    RB_tree::Thread_pool pool(3);
+    const std::span<const std::pair<int, int>> run(queries);
+    RB_tree::range_query_run(tree, run, std::span<long>(sharded), pool);
+    RB_tree::range_query_run(reference, run, std::span<long>(single), pool);
+    EXPECT_EQ(sharded, single);
+}
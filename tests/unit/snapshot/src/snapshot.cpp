@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "snapshot.hpp"
+#include "tree.hpp"
+#include <cstdio>
+#include <random>
+#include <unistd.h>
+#include <vector>
+
+using RB_tree::Snapshot_view;
+
+namespace {
+
+/// unnamed temporary file, removed when closed
+struct Temp_file {
+    std::FILE *file = std::tmpfile();
+
+    ~Temp_file() { std::fclose(file); }
+    int fd() const { return fileno(file); }
+};
+
+RB_tree::Tree<int> random_tree(std::size_t n, unsigned seed) {
+    RB_tree::Tree<int> tree;
+    std::mt19937 gen(seed);
+    while (tree.size() < n)
+        tree.insert(static_cast<int>(gen() % (n * 10)) - static_cast<int>(n));
+    return tree;
+}
+
+} // namespace
+
+TEST(SnapshotTest, ViewAndRebuildMatchTheTree) {
+    const auto tree = random_tree(10'000, 1);
+    Temp_file file;
+    ASSERT_TRUE(RB_tree::write_snapshot(file.fd(), tree));
+
+    Snapshot_view<int> view(file.fd());
+    ASSERT_TRUE(view.valid());
+    EXPECT_TRUE(view.verify());
+    ASSERT_EQ(view.size(), tree.size());
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), tree.begin(), tree.end()));
+
+    std::mt19937 gen(2);
+    std::uniform_int_distribution<int> dist(-20'000, 100'000);
+    for (int i = 0; i < 2000; ++i) {
+        const int lo = dist(gen);
+        const int hi = dist(gen);
+        EXPECT_EQ(view.rank(lo), tree.rank(lo));
+        EXPECT_EQ(view.count_in_range(lo, hi), tree.count_in_range(lo, hi));
+    }
+    EXPECT_EQ(*view.select(1234), *tree.select(1234));
+    EXPECT_EQ(view.select(view.size()), nullptr);
+
+    const auto rebuilt = RB_tree::Tree<int>::from_sorted(view.begin(), view.end());
+    EXPECT_TRUE(rebuilt.check_invariants());
+    EXPECT_TRUE(std::equal(rebuilt.begin(), rebuilt.end(), tree.begin(), tree.end()));
+}
+
+TEST(SnapshotTest, EmptySet) {
+    Temp_file file;
+    ASSERT_TRUE(RB_tree::write_snapshot(file.fd(), std::vector<int>{}));
+
+    Snapshot_view<int> view(file.fd());
+    ASSERT_TRUE(view.valid());
+    EXPECT_TRUE(view.verify());
+    EXPECT_TRUE(view.empty());
+    EXPECT_EQ(view.count_in_range(0, 10), 0u);
+    EXPECT_EQ(view.select(0), nullptr);
+}
+
+TEST(SnapshotTest, RejectsDamagedFiles) {
+    const std::vector<int> keys{1, 3, 5, 7, 9, 11, 13};
+    auto still_verifies = [&](auto damage) {
+        Temp_file file;
+        EXPECT_TRUE(RB_tree::write_snapshot(file.fd(), keys));
+        damage(file.fd());
+        return Snapshot_view<int>(file.fd()).verify();
+    };
+
+    EXPECT_TRUE(still_verifies([](int) {})); // the untouched file
+    EXPECT_FALSE(still_verifies([](int fd) { // a flipped key byte
+        const char byte = 0x40;
+        ASSERT_EQ(pwrite(fd, &byte, 1, RB_tree::snapshot::header_size + 9), 1);
+    }));
+    EXPECT_FALSE(still_verifies([](int fd) { // a torn write
+        ASSERT_EQ(ftruncate(fd, RB_tree::snapshot::header_size + 10), 0);
+    }));
+    EXPECT_FALSE(still_verifies([](int fd) { // a newer format
+        const char version = 2;
+        ASSERT_EQ(pwrite(fd, &version, 1, 4), 1);
+    }));
+    EXPECT_FALSE(still_verifies([](int fd) { // not a snapshot at all
+        ASSERT_EQ(pwrite(fd, "RQWL", 4, 0), 4);
+    }));
+
+    Temp_file file;
+    ASSERT_TRUE(RB_tree::write_snapshot(file.fd(), keys));
+    EXPECT_FALSE(Snapshot_view<long long>(file.fd()).valid()); // written with other keys
+}
+
+TEST(SnapshotTest, ChecksumDoesNotDependOnHowTheBytesArrive) {
+    std::vector<unsigned char> bytes(1000);
+    std::mt19937 gen(3);
+    for (auto &byte : bytes)
+        byte = static_cast<unsigned char>(gen());
+
+    const auto whole = RB_tree::snapshot::checksum(bytes.data(), bytes.size());
+    for (std::size_t piece : {1u, 7u, 32u, 100u}) {
+        RB_tree::snapshot::Checksum sum;
+        for (std::size_t done = 0; done < bytes.size(); done += piece)
+            sum.update(bytes.data() + done, std::min(piece, bytes.size() - done));
+        EXPECT_EQ(sum.value(), whole) << "pieces of " << piece;
+    }
+
+    bytes[500] ^= 1;
+    EXPECT_NE(RB_tree::snapshot::checksum(bytes.data(), bytes.size()), whole);
+}
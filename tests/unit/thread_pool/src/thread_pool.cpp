@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "range_query.hpp"
+#include "thread_pool.hpp"
+#include "tree.hpp"
+#include <atomic>
+#include <random>
+#include <utility>
+#include <vector>
+
+using RB_tree::Thread_pool;
+
+TEST(ThreadPoolTest, ParallelForVisitsEveryIndexOnce) {
+    Thread_pool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+
+    for (std::size_t n : {0u, 1u, 100u, 10'000u, 100'003u}) {
+        std::vector<std::atomic<int>> visits(n);
+        pool.parallel_for(n, [&](std::size_t begin, std::size_t end) {
+            for (auto i = begin; i != end; ++i)
+                visits[i].fetch_add(1, std::memory_order_relaxed);
+        });
+        for (std::size_t i = 0; i < n; ++i)
+            ASSERT_EQ(visits[i].load(), 1);
+    }
+}
+
+TEST(ThreadPoolTest, SingleThreadPoolRunsInline) {
+    Thread_pool pool(1);
+    std::size_t calls = 0;
+    pool.parallel_for(1000, [&](std::size_t begin, std::size_t end) {
+        EXPECT_EQ(begin, 0u);
+        EXPECT_EQ(end, 1000u);
+        ++calls;
+    });
+    EXPECT_EQ(calls, 1u);
+}
+
+TEST(ThreadPoolTest, RunTasksCallsEveryTaskOnce) {
+    Thread_pool pool(3);
+    for (std::size_t tasks : {0u, 1u, 2u, 5u, 300u}) {
+        std::vector<std::atomic<int>> calls(tasks);
+        pool.run_tasks(tasks, [&](std::size_t i) { calls[i].fetch_add(1); });
+        for (std::size_t i = 0; i < tasks; ++i)
+            ASSERT_EQ(calls[i].load(), 1);
+    }
+}
+
+TEST(ThreadPoolTest, QueryRunMatchesSerialAnswers) {
+    std::mt19937 gen(9);
+    std::uniform_int_distribution<int> dist(0, 100'000);
+
+    RB_tree::Tree<int> tree;
+    for (int i = 0; i < 2'000; ++i)
+        tree.insert(dist(gen));
+
+    std::vector<std::pair<int, int>> queries(5'000);
+    for (auto &[fst, snd] : queries) {
+        fst = dist(gen);
+        snd = dist(gen);
+    }
+
+    Thread_pool pool(3);
+    std::vector<long> results(queries.size());
+    RB_tree::range_query_run(tree, std::span<const std::pair<int, int>>(queries),
+                             std::span<long>(results), pool);
+
+    for (std::size_t i = 0; i < queries.size(); ++i)
+        ASSERT_EQ(results[i], RB_tree::range_query(tree, queries[i].first, queries[i].second));
+}
@@ -1,7 +1,13 @@
 #include <gtest/gtest.h>
-#include "tree.hpp" 
+#include "range_query.hpp"
+#include "tree.hpp"
 #include <vector>
 #include <algorithm>
+#include <random>
+#include <set>
+#include <cstdint>
+#include <functional>
+#include <string>
 
 TEST(RBTreeMoveTest, MoveConstructor) {
     RB_tree::Tree<int> t1;
@@ -93,3 +99,622 @@ TEST(RBTreeTest, BeginConsistencyWithLowerBound) {
     auto it2 = tree.lower_bound(0); 
     EXPECT_TRUE(it1 == it2);
 }
+
+TEST(RBTreeRankTest, RankOnEmptyTree) {
+    RB_tree::Tree<int> tree;
+    EXPECT_EQ(tree.rank(10), 0u);
+    EXPECT_EQ(tree.count_in_range(0, 100), 0u);
+}
+
+TEST(RBTreeRankTest, RankCountsSmallerKeys) {
+    RB_tree::Tree<int> tree;
+    for (int k : {10, 20, 30, 40, 50})
+        tree.insert(k);
+
+    EXPECT_EQ(tree.rank(5), 0u);
+    EXPECT_EQ(tree.rank(10), 0u);
+    EXPECT_EQ(tree.rank(11), 1u);
+    EXPECT_EQ(tree.rank(30), 2u);
+    EXPECT_EQ(tree.rank(50), 4u);
+    EXPECT_EQ(tree.rank(51), 5u);
+}
+
+TEST(RBTreeRankTest, CountInRangeIsInclusive) {
+    RB_tree::Tree<int> tree;
+    for (int k : {10, 20, 30, 40, 50})
+        tree.insert(k);
+
+    EXPECT_EQ(tree.count_in_range(10, 50), 5u);
+    EXPECT_EQ(tree.count_in_range(11, 49), 3u);
+    EXPECT_EQ(tree.count_in_range(20, 20), 1u);
+    EXPECT_EQ(tree.count_in_range(21, 29), 0u);
+    EXPECT_EQ(tree.count_in_range(50, 10), 0u);
+}
+
+TEST(RBTreeRankTest, CountInRangeMatchesLogDistance) {
+    RB_tree::Tree<int> tree;
+    std::vector<int> keys;
+    for (int i = 0; i < 500; ++i) {
+        int k = (i * 7919) % 1000;
+        if (tree.insert(k))
+            keys.push_back(k);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    for (int lo = -5; lo < 1005; lo += 13) {
+        for (int hi = lo; hi < 1005; hi += 17) {
+            auto expected = std::upper_bound(keys.begin(), keys.end(), hi) -
+                            std::lower_bound(keys.begin(), keys.end(), lo);
+            EXPECT_EQ(tree.count_in_range(lo, hi), static_cast<std::size_t>(expected));
+            EXPECT_EQ(tree.log_distance(tree.lower_bound(lo), tree.upper_bound(hi)), expected);
+        }
+    }
+}
+
+TEST(RBTreeRankTest, BoundsMatchSeparateDescents) {
+    RB_tree::Tree<int> tree;
+    for (int i = 0; i < 3000; ++i)
+        tree.insert((i * 7919) % 10007);
+
+    // uneven depths: lo and hi paths split near the root and end at different levels
+    for (int lo = -10; lo < 10020; lo += 97) {
+        for (int hi : {lo - 1, lo, lo + 3, lo + 500, 10020}) {
+            const auto [lower, upper] = tree.bounds(lo, hi);
+            EXPECT_EQ(lower, tree.lower_bound(lo));
+            EXPECT_EQ(upper, tree.upper_bound(hi));
+        }
+    }
+
+    RB_tree::Tree<int> empty;
+    const auto [lower, upper] = empty.bounds(1, 5);
+    EXPECT_EQ(lower, empty.end());
+    EXPECT_EQ(upper, empty.end());
+}
+
+TEST(RBTreeRankTest, DescentsWithCustomComparator) {
+    RB_tree::Tree<int, std::greater<int>> tree;
+    for (int i = 0; i < 200; ++i)
+        tree.insert(i);
+
+    EXPECT_EQ(*tree.lower_bound(150), 150);
+    EXPECT_EQ(*tree.upper_bound(150), 149);
+    EXPECT_EQ(tree.rank(150), 49u);
+    EXPECT_EQ(tree.count_in_range(150, 100), 51u);
+    EXPECT_EQ(tree.count_in_range(100, 150), 0u);
+}
+
+TEST(RBTreeRankTest, CountInRangeBatchMatchesCountInRange) {
+    RB_tree::Tree<int> tree;
+    for (int i = 0; i < 5000; ++i)
+        tree.insert((i * 7919) % 10007);
+
+    // 37 queries with reversed and empty intervals: two full groups of 16 and a partial group
+    // of 5, then twelve full groups of 3 and a partial group of 1
+    std::vector<std::pair<int, int>> queries;
+    for (int i = 0; i < 37; ++i) {
+        const int lo = (i * 271) % 10100 - 50;
+        queries.emplace_back(lo, i % 5 == 0 ? lo - 1 : lo + (i * 613) % 4000);
+    }
+
+    std::vector<std::size_t> out(queries.size());
+    tree.count_in_range_batch<16>(std::span<const std::pair<int, int>>(queries), std::span(out));
+    for (std::size_t i = 0; i < queries.size(); ++i)
+        EXPECT_EQ(out[i], tree.count_in_range(queries[i].first, queries[i].second));
+
+    std::vector<long> narrow(queries.size(), -1);
+    tree.count_in_range_batch<3>(std::span<const std::pair<int, int>>(queries),
+                                 std::span(narrow));
+    for (std::size_t i = 0; i < queries.size(); ++i)
+        EXPECT_EQ(narrow[i], static_cast<long>(out[i]));
+
+    RB_tree::Tree<int> empty;
+    empty.count_in_range_batch(std::span<const std::pair<int, int>>(queries), std::span(out));
+    EXPECT_TRUE(std::all_of(out.begin(), out.end(), [](std::size_t c) { return c == 0; }));
+}
+
+TEST(RBTreeRankTest, RangeQueryBatchMatchesRangeQuery) {
+    RB_tree::Tree<int> tree;
+    for (int i = 0; i < 1000; ++i)
+        tree.insert(i * 3);
+
+    const std::vector<std::pair<int, int>> queries{{0, 30}, {30, 30}, {50, 10}, {-5, 3000},
+                                                   {7, 8},  {9, 9},   {100, 200}};
+    std::vector<long> out(queries.size(), -1);
+    RB_tree::range_query_batch(tree, std::span(queries), std::span(out));
+    for (std::size_t i = 0; i < queries.size(); ++i)
+        EXPECT_EQ(out[i], RB_tree::range_query(tree, queries[i].first, queries[i].second));
+}
+
+TEST(RBTreeAllocatorTest, StdAllocatorTreeMatchesArenaTree) {
+    RB_tree::Tree<int> arena_tree;
+    RB_tree::Tree<int, std::less<int>, std::allocator<int>> heap_tree;
+    for (int i = 0; i < 1000; ++i) {
+        int k = (i * 37) % 1009;
+        EXPECT_EQ(arena_tree.insert(k), heap_tree.insert(k));
+    }
+    EXPECT_TRUE(std::equal(arena_tree.begin(), arena_tree.end(), heap_tree.begin(),
+                           heap_tree.end()));
+}
+
+TEST(RBTreeAllocatorTest, ArenaRecyclesFreedSlots) {
+    RB_tree::Arena arena(sizeof(RB_tree::Node<int>), alignof(RB_tree::Node<int>));
+
+    void *first = arena.allocate(1);
+    void *second = arena.allocate(1);
+    EXPECT_NE(first, second);
+
+    arena.deallocate(first, 1);
+    EXPECT_EQ(arena.allocate(1), first);
+}
+
+TEST(RBTreeAllocatorTest, ArenaAllocatesAdjacentSlots) {
+    RB_tree::Arena arena(sizeof(RB_tree::Node<int>), alignof(RB_tree::Node<int>));
+
+    auto *block = static_cast<std::byte *>(arena.allocate(1000));
+    EXPECT_GE(arena.capacity_bytes(), 1000 * arena.slot_size());
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignof(RB_tree::Node<int>), 0u);
+}
+
+TEST(RBTreeAllocatorTest, MovedTreeKeepsArena) {
+    RB_tree::Tree<std::string> t1;
+    t1.insert("b");
+    t1.insert("a");
+    auto arena = t1.get_allocator().arena();
+
+    RB_tree::Tree<std::string> t2 = std::move(t1);
+    EXPECT_EQ(t2.get_allocator().arena(), arena);
+    EXPECT_EQ(*t2.begin(), "a");
+}
+
+TEST(RBTreeAllocatorTest, TreesFromOneKeyAllocatorShareNodes) {
+    // the node type does not fit the int slots, so the nodes come from a sibling arena
+    RB_tree::Arena_allocator<int> keys;
+    RB_tree::Tree<int> t1(keys);
+    RB_tree::Tree<int> t2(keys);
+    EXPECT_TRUE(t1.get_allocator() == t2.get_allocator());
+    EXPECT_EQ(t1.get_allocator().arena(), t2.get_allocator().arena());
+    EXPECT_NE(t1.get_allocator().arena(), keys.arena());
+    EXPECT_TRUE(RB_tree::Arena_allocator<int>(t1.get_allocator()) == keys);
+    EXPECT_EQ(RB_tree::Arena_allocator<int>(t1.get_allocator()).arena(), keys.arena());
+
+    for (int i = 0; i < 100; ++i) {
+        t1.insert(i);
+        t2.insert(100 + i);
+    }
+    const int *moved = &*t2.begin();
+    t1.join(std::move(t2));
+    EXPECT_TRUE(t2.empty());
+    ASSERT_TRUE(t1.check_invariants());
+    EXPECT_EQ(t1.size(), 200u);
+    EXPECT_EQ(&*t1.lower_bound(100), moved); // relinked, not copied
+}
+
+TEST(RBTreeBulkLoadTest, FromSortedBuildsValidTreeOfEverySize) {
+    for (int n = 0; n < 300; ++n) {
+        std::vector<int> keys(n);
+        for (int i = 0; i < n; ++i)
+            keys[i] = 2 * i;
+
+        auto tree = RB_tree::Tree<int>::from_sorted(keys.begin(), keys.end());
+        ASSERT_TRUE(tree.check_invariants()) << "n = " << n;
+        EXPECT_EQ(tree.size(), static_cast<std::size_t>(n));
+        EXPECT_TRUE(std::equal(tree.begin(), tree.end(), keys.begin(), keys.end()));
+    }
+}
+
+TEST(RBTreeBulkLoadTest, FromSortedSkipsRepeatedKeys) {
+    std::vector<int> keys = {1, 1, 2, 3, 3, 3, 7};
+    auto tree = RB_tree::Tree<int>::from_sorted(keys.begin(), keys.end());
+
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_EQ(std::vector<int>(tree.begin(), tree.end()), (std::vector<int>{1, 2, 3, 7}));
+}
+
+TEST(RBTreeBulkLoadTest, FromSortedPlacesNodesContiguously) {
+    std::vector<int> keys(1000);
+    for (int i = 0; i < 1000; ++i)
+        keys[i] = i;
+    auto tree = RB_tree::Tree<int>::from_sorted(keys.begin(), keys.end());
+
+    for (auto it = tree.begin(), next = std::next(it); next != tree.end(); ++it, ++next)
+        EXPECT_EQ(next.get() - it.get(), 1);
+}
+
+TEST(RBTreeBulkLoadTest, AssignSortsAndReplacesContents) {
+    RB_tree::Tree<int> tree;
+    tree.insert(100);
+    tree.insert(-5);
+
+    tree.assign(std::vector<int>{9, 3, 7, 3, 1, 9, 5});
+
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_EQ(std::vector<int>(tree.begin(), tree.end()), (std::vector<int>{1, 3, 5, 7, 9}));
+    EXPECT_EQ(tree.count_in_range(2, 8), 3u);
+}
+
+TEST(RBTreeBulkLoadTest, InsertAfterBulkLoadKeepsInvariants) {
+    std::vector<int> keys;
+    for (int i = 0; i < 500; ++i)
+        keys.push_back(i * 3);
+
+    RB_tree::Tree<int, std::less<int>, std::allocator<int>> tree;
+    tree.assign(keys);
+    for (int i = 0; i < 500; ++i)
+        tree.insert(i * 3 + 1);
+
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_EQ(tree.size(), 1000u);
+    EXPECT_EQ(tree.rank(301), 201u);
+}
+
+TEST(RBTreeBulkLoadTest, ClearEmptiesTree) {
+    RB_tree::Tree<std::string> tree;
+    tree.assign(std::vector<std::string>{"b", "a", "c"});
+    tree.clear();
+
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.begin(), tree.end());
+    tree.insert("z");
+    EXPECT_EQ(*tree.begin(), "z");
+}
+
+TEST(RBTreeTest, InsertKeepsInvariants) {
+    RB_tree::Tree<int> tree;
+    for (int i = 0; i < 2000; ++i) {
+        tree.insert((i * 7919) % 4001);
+        if (i % 100 == 0) {
+            ASSERT_TRUE(tree.check_invariants());
+        }
+    }
+    EXPECT_TRUE(tree.check_invariants());
+}
+
+TEST(RBTreeBatchInsertTest, BatchIntoEmptyTree) {
+    RB_tree::Tree<int> tree;
+    std::vector<int> batch = {5, 1, 4, 1, 3};
+
+    EXPECT_EQ(tree.insert_batch(batch), 4u);
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_EQ(std::vector<int>(tree.begin(), tree.end()), (std::vector<int>{1, 3, 4, 5}));
+}
+
+TEST(RBTreeBatchInsertTest, SmallBatchesUseFingerInsertion) {
+    RB_tree::Tree<int> tree;
+    std::set<int> expected;
+    for (int i = 0; i < 4000; ++i) {
+        tree.insert(i * 10);
+        expected.insert(i * 10);
+    }
+
+    for (int round = 0; round < 50; ++round) {
+        std::vector<int> batch;
+        for (int j = 0; j < 20; ++j)
+            batch.push_back((round * 7919 + j * 131) % 40000);
+
+        std::size_t fresh = 0;
+        for (int key : batch)
+            fresh += expected.insert(key).second;
+
+        EXPECT_EQ(tree.insert_batch(batch), fresh);
+    }
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_TRUE(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+}
+
+TEST(RBTreeBatchInsertTest, LargeBatchIsMergedAndRebuilt) {
+    RB_tree::Tree<int> tree;
+    for (int i = 0; i < 100; ++i)
+        tree.insert(i * 2);
+
+    std::vector<int> batch;
+    for (int i = 0; i < 300; ++i)
+        batch.push_back(i);
+
+    EXPECT_EQ(tree.insert_batch(batch), 200u);
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_EQ(tree.size(), 300u);
+    EXPECT_EQ(*tree.begin(), 0);
+    EXPECT_EQ(tree.count_in_range(100, 199), 100u);
+}
+
+TEST(RBTreeHintTest, MonotonicInsertWithEndHint) {
+    RB_tree::Tree<int> tree;
+    for (int i = 0; i < 1000; ++i) {
+        auto it = tree.insert(tree.end(), i);
+        EXPECT_EQ(*it, i);
+    }
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_EQ(tree.size(), 1000u);
+    EXPECT_EQ(tree.rank(500), 500u);
+}
+
+TEST(RBTreeHintTest, InsertWithPreviousPositionAsHint) {
+    RB_tree::Tree<int> tree;
+    std::set<int> expected;
+    auto hint = tree.end();
+    for (int i = 0; i < 2000; ++i) {
+        int key = (i / 8) * 8 + (7 - i % 8) + ((i * 31) % 5 == 0 ? 5000 : 0);
+        hint = tree.insert(hint, key);
+        expected.insert(key);
+        EXPECT_EQ(*hint, key);
+    }
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_TRUE(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+}
+
+TEST(RBTreeHintTest, InsertOfPresentKeyReturnsIt) {
+    RB_tree::Tree<int> tree;
+    for (int k : {10, 20, 30})
+        tree.insert(k);
+
+    auto it = tree.insert(tree.begin(), 30);
+    EXPECT_EQ(*it, 30);
+    EXPECT_EQ(tree.size(), 3u);
+}
+
+TEST(RBTreeHintTest, HintedLowerBoundMatchesPlainLowerBound) {
+    RB_tree::Tree<int> tree;
+    for (int i = 0; i < 300; ++i)
+        tree.insert(i * 3);
+
+    std::vector<RB_tree::Tree<int>::iterator> hints;
+    for (auto it = tree.begin(); it != tree.end(); ++it)
+        hints.push_back(it);
+    hints.push_back(tree.end());
+
+    for (std::size_t h = 0; h < hints.size(); h += 7)
+        for (int key = -2; key < 905; ++key)
+            ASSERT_EQ(tree.lower_bound(hints[h], key), tree.lower_bound(key))
+                << "hint index " << h << ", key " << key;
+}
+
+TEST(RBTreeEraseTest, EraseMissingKeyIsNoop) {
+    RB_tree::Tree<int> tree;
+    EXPECT_EQ(tree.erase(1), 0u);
+    tree.insert(2);
+    EXPECT_EQ(tree.erase(1), 0u);
+    EXPECT_EQ(tree.size(), 1u);
+}
+
+TEST(RBTreeEraseTest, EraseLastKeyEmptiesTree) {
+    RB_tree::Tree<int> tree;
+    tree.insert(5);
+    EXPECT_EQ(tree.erase(5), 1u);
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.begin(), tree.end());
+    EXPECT_TRUE(tree.check_invariants());
+}
+
+TEST(RBTreeEraseTest, EraseKeepsOrderStatistics) {
+    RB_tree::Tree<int> tree;
+    std::set<int> expected;
+    for (int i = 0; i < 3000; ++i) {
+        int k = (i * 7919) % 5003;
+        tree.insert(k);
+        expected.insert(k);
+    }
+
+    for (int i = 0; i < 4000; ++i) {
+        int k = (i * 4391) % 5003;
+        EXPECT_EQ(tree.erase(k), expected.erase(k));
+        if (i % 250 == 0) {
+            ASSERT_TRUE(tree.check_invariants());
+            for (int lo = 0; lo < 5003; lo += 397) {
+                auto expect =
+                    std::distance(expected.lower_bound(lo), expected.upper_bound(lo + 500));
+                EXPECT_EQ(tree.count_in_range(lo, lo + 500), static_cast<std::size_t>(expect));
+            }
+        }
+    }
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_TRUE(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+}
+
+TEST(RBTreeEraseTest, EraseIteratorReturnsNext) {
+    RB_tree::Tree<int> tree;
+    for (int k : {1, 2, 3, 4, 5})
+        tree.insert(k);
+
+    auto it = tree.erase(tree.lower_bound(3));
+    EXPECT_EQ(*it, 4);
+    it = tree.erase(tree.begin());
+    EXPECT_EQ(*it, 2);
+    EXPECT_EQ(*tree.begin(), 2);
+
+    it = tree.erase(tree.lower_bound(5));
+    EXPECT_EQ(it, tree.end());
+    EXPECT_EQ(std::vector<int>(tree.begin(), tree.end()), (std::vector<int>{2, 4}));
+    EXPECT_TRUE(tree.check_invariants());
+}
+
+TEST(RBTreeEraseTest, InterleavedInsertAndErase) {
+    RB_tree::Tree<std::string> tree;
+    std::set<std::string> expected;
+    for (int i = 0; i < 3000; ++i) {
+        auto key = std::to_string((i * 37) % 701);
+        if (i % 3 == 2) {
+            EXPECT_EQ(tree.erase(key), expected.erase(key));
+        } else {
+            EXPECT_EQ(tree.insert(key), expected.insert(key).second);
+        }
+    }
+    EXPECT_TRUE(tree.check_invariants());
+    EXPECT_TRUE(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+}
+
+TEST(RBTreeSelectTest, SelectIsInverseOfRank) {
+    RB_tree::Tree<int> tree;
+    for (int i = 0; i < 1000; ++i)
+        tree.insert((i * 7919) % 10007);
+
+    for (std::size_t k = 0; k < tree.size(); ++k) {
+        auto it = tree.select(k);
+        ASSERT_NE(it, tree.end());
+        EXPECT_EQ(tree.rank(*it), k);
+    }
+    EXPECT_EQ(tree.select(tree.size()), tree.end());
+}
+
+TEST(RBTreeSelectTest, SelectOnEmptyTree) {
+    RB_tree::Tree<int> tree;
+    EXPECT_EQ(tree.select(0), tree.end());
+}
+
+TEST(RBTreeSelectTest, PercentileRangeUsesNearestRank) {
+    RB_tree::Tree<int> tree;
+    for (int k = 1; k <= 200; ++k)
+        tree.insert(k * 10);
+
+    auto [median, p99] = RB_tree::percentile_range(tree, 50, 99);
+    EXPECT_EQ(*median, 1000);
+    EXPECT_EQ(*p99, 1980);
+
+    auto [min, max] = RB_tree::percentile_range(tree, 0, 100);
+    EXPECT_EQ(*min, 10);
+    EXPECT_EQ(*max, 2000);
+
+    std::set<int> set(tree.begin(), tree.end());
+    EXPECT_EQ(*RB_tree::percentile_range(set, 50, 99).second, 1980);
+}
+
+TEST(RBTreeSplitJoinTest, SplitAtEveryKindOfKey) {
+    RB_tree::Tree<int> tree;
+    std::set<int> expected;
+    for (int i = 0; i < 2000; ++i) {
+        tree.insert((i * 7919) % 10007);
+        expected.insert((i * 7919) % 10007);
+    }
+
+    for (int key : {-1, 0, 5000, *expected.begin(), *expected.rbegin(), 10007, 20000}) {
+        RB_tree::Tree<int> left(tree.get_allocator());
+        left.merge(std::move(tree));
+        auto right = left.split(key);
+
+        ASSERT_TRUE(left.check_invariants()) << "key " << key;
+        ASSERT_TRUE(right.check_invariants()) << "key " << key;
+        EXPECT_TRUE(std::equal(left.begin(), left.end(), expected.begin(),
+                               expected.lower_bound(key)));
+        EXPECT_TRUE(std::equal(right.begin(), right.end(), expected.lower_bound(key),
+                               expected.end()));
+        EXPECT_EQ(right.rank(key), 0u);
+
+        left.join(std::move(right));
+        EXPECT_TRUE(right.empty());
+        ASSERT_TRUE(left.check_invariants());
+        tree = std::move(left);
+    }
+    EXPECT_TRUE(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+}
+
+TEST(RBTreeSplitJoinTest, JoinTreesOfDifferentHeights) {
+    for (int small : {1, 2, 7, 100}) {
+        for (bool small_first : {true, false}) {
+            const int big = 5000;
+            const int split_at = small_first ? small : big;
+            RB_tree::Tree<int> left;
+            for (int k = 0; k < small + big; ++k)
+                left.insert(k);
+            auto right = left.split(split_at);
+
+            // the shorter tree joins the taller one from either side
+            left.join(std::move(right));
+            ASSERT_TRUE(left.check_invariants()) << small << ' ' << small_first;
+            EXPECT_EQ(left.size(), static_cast<std::size_t>(small + big));
+            EXPECT_EQ(*left.select(static_cast<std::size_t>(split_at)), split_at);
+        }
+    }
+}
+
+TEST(RBTreeSplitJoinTest, MergeInterleavedAndDisjointTrees) {
+    std::mt19937 gen(5);
+    for (int round = 0; round < 50; ++round) {
+        RB_tree::Tree<int> a;
+        RB_tree::Tree<int> b(a.get_allocator());
+        std::set<int> expected;
+        const int spread = round % 2 == 0 ? 1000 : 100'000;
+        for (int i = 0; i < 700; ++i) {
+            const int x = static_cast<int>(gen() % 1000);
+            const int y = static_cast<int>(gen() % spread) + (round % 3 == 0 ? 5000 : 0);
+            a.insert(x);
+            b.insert(y);
+            expected.insert(x);
+            expected.insert(y);
+        }
+
+        const auto old_size = a.size();
+        EXPECT_EQ(a.merge(std::move(b)), expected.size() - old_size);
+        EXPECT_TRUE(b.empty());
+        ASSERT_TRUE(a.check_invariants());
+        ASSERT_TRUE(std::equal(a.begin(), a.end(), expected.begin(), expected.end()));
+    }
+}
+
+TEST(RBTreeSplitJoinTest, TreesWithOtherArenasAreCopied) {
+    RB_tree::Tree<std::string> a;
+    RB_tree::Tree<std::string> b;
+    for (int i = 0; i < 100; ++i) {
+        std::string key = "a";
+        key += std::to_string(i);
+        a.insert(key);
+        key[0] = 'b';
+        b.insert(key);
+    }
+    a.join(std::move(b));
+    EXPECT_EQ(a.size(), 200u);
+    EXPECT_TRUE(b.empty());
+
+    RB_tree::Tree<std::string> c;
+    c.insert("a1");
+    c.insert("c");
+    EXPECT_EQ(a.merge(std::move(c)), 1u);
+    EXPECT_TRUE(a.check_invariants());
+    EXPECT_EQ(*a.select(a.size() - 1), "c");
+}
+
+TEST(RBTreeParallelTest, ParallelFromSortedMatchesFromSorted) {
+    RB_tree::Thread_pool pool(4);
+    std::mt19937 gen(5);
+    for (std::size_t n : {0u, 1u, 1000u, 70'000u, 200'001u}) {
+        std::vector<int> keys(n);
+        for (auto &key : keys)
+            key = static_cast<int>(gen() % (n + 1) * 3);
+        std::sort(keys.begin(), keys.end());
+
+        auto parallel = RB_tree::Tree<int>::from_sorted(keys.begin(), keys.end(), pool);
+        auto serial = RB_tree::Tree<int>::from_sorted(keys.begin(), keys.end());
+        ASSERT_TRUE(parallel.check_invariants());
+        ASSERT_EQ(parallel.size(), serial.size());
+        ASSERT_TRUE(std::equal(parallel.begin(), parallel.end(), serial.begin(), serial.end()));
+    }
+}
+
+TEST(RBTreeParallelTest, ParallelInsertBatchMatchesStdSet) {
+    RB_tree::Thread_pool pool(4);
+    std::mt19937 gen(6);
+    std::uniform_int_distribution<int> dist(0, 4'000'000);
+    RB_tree::Tree<int> tree;
+    std::set<int> expected;
+
+    // into an empty tree, batches split among the pieces, one too small for the pool and one
+    // that rebuilds
+    for (std::size_t batch : {1'000'000u, 20'000u, 40'000u, 3000u, 600'000u}) {
+        std::vector<int> keys(batch);
+        for (auto &key : keys)
+            key = dist(gen);
+        std::size_t added = 0;
+        for (int key : keys)
+            added += expected.insert(key).second;
+
+        ASSERT_EQ(tree.insert_batch(keys, pool), added);
+        ASSERT_TRUE(tree.check_invariants());
+        ASSERT_EQ(tree.size(), expected.size());
+        ASSERT_TRUE(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+    }
+
+    // nodes of repeated keys go back to the arena and are reused
+    for (int i = 0; i < 1000; ++i)
+        tree.erase(dist(gen));
+    for (int i = 0; i < 1000; ++i)
+        tree.insert(dist(gen));
+    EXPECT_TRUE(tree.check_invariants());
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "range_query.hpp"
+#include "versioned_tree.hpp"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using RB_tree::Versioned_tree;
+
+namespace {
+
+long live_allocations = 0;
+
+/// std::allocator that counts what is still allocated
+template <typename T> struct Counting_allocator {
+    using value_type = T;
+
+    Counting_allocator() = default;
+    template <typename U> Counting_allocator(const Counting_allocator<U> &) noexcept {}
+
+    T *allocate(std::size_t n) {
+        ++live_allocations;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) noexcept {
+        --live_allocations;
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U> bool operator==(const Counting_allocator<U> &) const noexcept {
+        return true;
+    }
+};
+
+} // namespace
+
+TEST(VersionedTreeTest, EveryVersionMatchesItsStdSet) {
+    Versioned_tree<int> tree;
+    std::vector<std::set<int>> history{{}};
+    std::mt19937 gen(11);
+    std::uniform_int_distribution<int> dist(0, 800);
+
+    for (int step = 0; step < 3000; ++step) {
+        const int key = dist(gen);
+        auto next = history.back();
+        bool changed = false;
+        if (gen() % 3 == 0) {
+            changed = next.erase(key) != 0;
+            EXPECT_EQ(tree.erase(key), changed ? 1u : 0u);
+        } else {
+            changed = next.insert(key).second;
+            EXPECT_EQ(tree.insert(key), changed);
+        }
+        if (changed)
+            history.push_back(std::move(next));
+        ASSERT_EQ(tree.version(), history.size() - 1);
+        ASSERT_TRUE(tree.check_invariants(tree.version()));
+    }
+
+    // old versions are untouched by everything that came after them
+    for (std::size_t v = 0; v < history.size(); v += 7) {
+        const auto &keys = history[v];
+        ASSERT_TRUE(tree.check_invariants(v));
+        ASSERT_EQ(tree.size(v), keys.size());
+        for (int i = 0; i < 20; ++i) {
+            const int lo = dist(gen);
+            const int hi = lo + dist(gen) / 4;
+            const auto expected = std::distance(keys.lower_bound(lo), keys.upper_bound(hi));
+            ASSERT_EQ(tree.count_in_range(v, lo, hi), static_cast<std::size_t>(expected));
+        }
+        if (!keys.empty()) {
+            EXPECT_EQ(*tree.select(v, keys.size() / 2),
+                      *std::next(keys.begin(), static_cast<long>(keys.size() / 2)));
+        }
+    }
+}
+
+TEST(VersionedTreeTest, RangeQueryOnAVersion) {
+    Versioned_tree<int> tree;
+    for (int key = 1; key <= 10; ++key)
+        tree.insert(key * 10);
+    tree.erase(50);
+
+    EXPECT_EQ(RB_tree::range_query(tree, 3, 10, 60), 3);  // 10..30, before any erase
+    EXPECT_EQ(RB_tree::range_query(tree, 10, 10, 60), 6); // 10..60
+    EXPECT_EQ(RB_tree::range_query(tree, 11, 10, 60), 5); // 50 is gone
+    EXPECT_EQ(RB_tree::range_query(tree, 11, 60, 10), 0);
+    EXPECT_EQ(RB_tree::range_query(tree, 0, 10, 60), 0);
+    EXPECT_EQ(tree.erase(50), 0u);
+    EXPECT_FALSE(tree.insert(10));
+    EXPECT_EQ(tree.version(), 11u);
+}
+
+TEST(VersionedTreeTest, VersionCostIsLogarithmic) {
+    Versioned_tree<int> tree;
+    std::mt19937 gen(2);
+    constexpr int n = 1 << 14;
+    for (int i = 0; i < n; ++i)
+        tree.insert(static_cast<int>(gen() % 1'000'000));
+
+    const auto before_nodes = tree.node_count();
+    const auto before_version = tree.version();
+    for (int i = 0; i < 2000; ++i) {
+        tree.insert(static_cast<int>(gen() % 1'000'000));
+        tree.erase(static_cast<int>(gen() % 1'000'000));
+    }
+
+    // a red-black tree of n keys is at most 2 log2(n + 1) deep; an update copies its path and
+    // the siblings it recolors
+    const double bound = 2 * (2 * std::log2(static_cast<double>(tree.size()) + 1) + 2);
+    const auto versions = tree.version() - before_version;
+    ASSERT_GT(versions, 0u);
+    EXPECT_LE(static_cast<double>(tree.node_count() - before_nodes) / versions, bound);
+}
+
+TEST(VersionedTreeTest, ReleasesEveryNode) {
+    {
+        Versioned_tree<std::string, std::less<std::string>, Counting_allocator<std::string>> tree;
+        std::mt19937 gen(4);
+        for (int i = 0; i < 2000; ++i) {
+            const auto key = std::to_string(gen() % 500);
+            if (i % 4 == 3)
+                tree.erase(key);
+            else
+                tree.insert(key);
+        }
+        EXPECT_EQ(static_cast<long>(tree.node_count()), live_allocations);
+    }
+    EXPECT_EQ(live_allocations, 0);
+}
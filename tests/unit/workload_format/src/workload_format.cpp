@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "workload_format.hpp"
+#include <climits>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using RB_tree::Command;
+using RB_tree::Workload_reader;
+using RB_tree::Workload_writer;
+
+namespace {
+
+std::string encode(const std::vector<Command> &commands) {
+    std::ostringstream out(std::ios::binary);
+    Workload_writer writer(out);
+    for (const auto &cmd : commands)
+        EXPECT_TRUE(writer.write(cmd));
+    return out.str();
+}
+
+/// decodes bytes through a temporary file, since Workload_reader maps its input
+std::vector<Command> decode(const std::string &bytes, bool *valid = nullptr,
+                            bool *corrupt = nullptr) {
+    std::FILE *file = std::tmpfile();
+    std::fwrite(bytes.data(), 1, bytes.size(), file);
+    std::fflush(file);
+
+    Workload_reader reader(fileno(file));
+    std::vector<Command> commands;
+    Command cmd;
+    while (reader.next(cmd))
+        commands.push_back(cmd);
+    if (valid)
+        *valid = reader.valid();
+    if (corrupt)
+        *corrupt = reader.corrupt();
+    std::fclose(file);
+    return commands;
+}
+
+} // namespace
+
+TEST(WorkloadFormatTest, RoundTripsEveryCommand) {
+    const std::vector<Command> commands{
+        {'k', {257183, 0}},          {'q', {59860, 66462}},  {'d', {257183, 0}},
+        {'k', {INT_MIN, 0}},         {'k', {INT_MAX, 0}},    {'q', {INT_MAX, INT_MIN}},
+        {'s', {1, 0}},               {'p', {50, 99}},        {'k', {-5, 0}},
+        {'q', {INT_MIN, INT_MAX}}};
+
+    const auto decoded = decode(encode(commands));
+    ASSERT_EQ(decoded.size(), commands.size());
+    for (std::size_t i = 0; i < commands.size(); ++i) {
+        EXPECT_EQ(decoded[i].op, commands[i].op);
+        EXPECT_EQ(decoded[i].args[0], commands[i].args[0]);
+        if (RB_tree::command_arity(commands[i].op) == 2) {
+            EXPECT_EQ(decoded[i].args[1], commands[i].args[1]);
+        }
+    }
+}
+
+TEST(WorkloadFormatTest, SmallDeltasTakeFewBytes) {
+    std::vector<Command> commands;
+    for (int key = 1000; key < 2000; ++key)
+        commands.push_back({'k', {key, 0}});
+    // header plus one byte per record: delta 1 zigzags to 2, shifted past the op code
+    EXPECT_EQ(encode(commands).size(), RB_tree::workload::header_size + 1000 + 1);
+}
+
+TEST(WorkloadFormatTest, RejectsBadHeaderAndTruncatedRecords) {
+    bool valid = true;
+    EXPECT_TRUE(decode("k 1 q 1 2\n", &valid).empty());
+    EXPECT_FALSE(valid);
+
+    auto bytes = encode({{'k', {1, 0}}, {'q', {100000, 900000}}});
+    bytes.pop_back();
+    bool corrupt = false;
+    const auto decoded = decode(bytes, &valid, &corrupt);
+    EXPECT_TRUE(valid);
+    EXPECT_TRUE(corrupt);
+    EXPECT_EQ(decoded.size(), 1u);
+
+    Command unknown{'z', {0, 0}};
+    std::ostringstream out;
+    Workload_writer writer(out);
+    EXPECT_FALSE(writer.write(unknown));
+}